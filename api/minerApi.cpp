@@ -0,0 +1,472 @@
+// HDS OpenCL Miner
+// Metrics and control API
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "minerApi.h"
+
+namespace hdsMiner {
+
+// Escaping for JSON strings and Prometheus label values, the names of devices and pools are the only free text
+static string escape(const string& input) {
+	string result;
+	for (char c : input) {
+		if ((c == '"') || (c == '\\')) {
+			result.push_back('\\');
+			result.push_back(c);
+		} else if (c == '\n') {
+			result += "\\n";
+		} else if ((unsigned char) c >= 0x20) {
+			result.push_back(c);
+		}
+	}
+	return result;
+}
+
+
+static string windowName(uint32_t w) {
+	return (statWindowSec[w] < 3600) ? to_string(statWindowSec[w] / 60) + "m" : to_string(statWindowSec[w] / 3600) + "h";
+}
+
+
+static bool isControl(const string& method) {
+	return (method == "pause") || (method == "resume") || (method == "switch") || (method == "tune");
+}
+
+
+// One HTTP request per connection, the answer closes it. The request may not exceed maxRequestBytes
+// and must arrive within requestTimeoutSec, so remote clients can neither grow the buffer nor hold the socket.
+static const size_t maxRequestBytes = 8192;
+static const uint32_t requestTimeoutSec = 10;
+
+class httpSession : public std::enable_shared_from_this<httpSession> {
+	public:
+	tcp::socket socket;
+	boost::asio::streambuf request;
+	boost::asio::steady_timer deadline;
+	string response;
+	minerApi *api;
+
+	httpSession(boost::asio::io_service& ios, minerApi* apiIn) : socket(ios), request(maxRequestBytes), deadline(ios) {
+		api = apiIn;
+	}
+
+	void start() {
+		deadline.expires_after(std::chrono::seconds(requestTimeoutSec));
+		deadline.async_wait(boost::bind(&httpSession::handleTimeout, shared_from_this(), boost::asio::placeholders::error));
+
+		boost::asio::async_read_until(socket, request, "\r\n\r\n",
+			boost::bind(&httpSession::handleRead, shared_from_this(), boost::asio::placeholders::error));
+	}
+
+	private:
+	void close() {
+		boost::system::error_code ec;
+		deadline.cancel(ec);
+		socket.shutdown(tcp::socket::shutdown_both, ec);
+		socket.close(ec);
+	}
+
+	void handleTimeout(const boost::system::error_code& err) {
+		if (err != boost::asio::error::operation_aborted) close();
+	}
+
+	void handleRead(const boost::system::error_code& err) {
+		if (err) {
+			close();
+			return;
+		}
+
+		std::istream is(&request);
+		string verb, target, line;
+		is >> verb >> target;
+		getline(is, line);
+
+		// Header names are case insensitive
+		string origin, token;
+		bool hasOrigin = false;
+		while (getline(is, line) && (line != "\r") && !line.empty()) {
+			size_t colon = line.find(':');
+			if (colon == string::npos) continue;
+			string name = line.substr(0, colon);
+			std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+			string value = line.substr(colon + 1);
+			value.erase(0, value.find_first_not_of(" \t"));
+			value.erase(value.find_last_not_of(" \t\r") + 1);
+			if (name == "origin") hasOrigin = true;
+			if (name == "x-hds-token") token = value;
+		}
+
+		// The path selects the method, the query holds its parameters
+		string path = target.substr(0, target.find('?'));
+		pt::ptree params;
+		if (target.find('?') != string::npos) {
+			stringstream query(target.substr(target.find('?') + 1));
+			string pair;
+			while (getline(query, pair, '&')) {
+				size_t eq = pair.find('=');
+				if (eq != string::npos) params.put(pair.substr(0, eq), pair.substr(eq + 1));
+			}
+		}
+
+		string method = (path.size() > 1) ? path.substr(1) : "status";
+		boost::system::error_code ec;
+		bool local = socket.remote_endpoint(ec).address().is_loopback();
+
+		// Browsers send an Origin with every cross site request, a web page must not reach the API. Control
+		// commands also need the token of --apiToken in a header, which a page can not send without preflight.
+		apiReply reply;
+		if (hasOrigin) {
+			reply.status = 403;
+			reply.body = "{\"error\":\"requests from web pages are not accepted\"}";
+		} else if (isControl(method) && (verb != "POST")) {
+			reply.status = 405;
+			reply.body = "{\"error\":\"control commands need POST\"}";
+		} else if (isControl(method) && !api->tokenMatches(token)) {
+			reply.status = 403;
+			reply.body = "{\"error\":\"control commands need the X-Hds-Token header with the token of --apiToken\"}";
+		} else {
+			reply = api->handleRequest(method, params, local);
+		}
+
+		const char* reason = "OK";
+		if (reply.status == 400) reason = "Bad Request";
+		if (reply.status == 403) reason = "Forbidden";
+		if (reply.status == 404) reason = "Not Found";
+		if (reply.status == 405) reason = "Method Not Allowed";
+		stringstream out;
+		out << "HTTP/1.1 " << reply.status << " " << reason << "\r\nContent-Type: " << reply.contentType
+		    << "\r\nContent-Length: " << reply.body.size() << "\r\nConnection: close\r\n\r\n" << reply.body;
+		response = out.str();
+
+		boost::asio::async_write(socket, boost::asio::buffer(response),
+			boost::bind(&httpSession::handleWrite, shared_from_this(), boost::asio::placeholders::error));
+	}
+
+	// The connection closes after the answer whether the write succeeded or not
+	void handleWrite(const boost::system::error_code&) {
+		close();
+	}
+};
+
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+// Unix socket connection, one JSON request per line
+class localSession : public std::enable_shared_from_this<localSession> {
+	public:
+	boost::asio::local::stream_protocol::socket socket;
+	boost::asio::streambuf request;
+	string response;
+	minerApi *api;
+
+	localSession(boost::asio::io_service& ios, minerApi* apiIn) : socket(ios), request(maxRequestBytes) {
+		api = apiIn;
+	}
+
+	void start() {
+		boost::asio::async_read_until(socket, request, "\n",
+			boost::bind(&localSession::handleRead, shared_from_this(), boost::asio::placeholders::error));
+	}
+
+	private:
+	void handleRead(const boost::system::error_code& err) {
+		if (err) return;
+
+		std::istream is(&request);
+		string line;
+		getline(is, line);
+
+		apiReply reply;
+		try {
+			pt::ptree params;
+			istringstream jsonStream(line);
+			pt::read_json(jsonStream, params);
+			reply = api->handleRequest(params.get<string>("method", "status"), params, true);
+		} catch (const pt::ptree_error &e) {
+			reply.status = 400;
+			reply.body = "{\"error\":\"invalid json\"}";
+		}
+
+		// Metrics are text, on this socket they are wrapped into JSON
+		if (reply.contentType != "application/json") reply.body = "{\"metrics\":\"" + escape(reply.body) + "\"}";
+		response = reply.body + "\n";
+
+		boost::asio::async_write(socket, boost::asio::buffer(response),
+			boost::bind(&localSession::handleWrite, shared_from_this(), boost::asio::placeholders::error));
+	}
+
+	void handleWrite(const boost::system::error_code& err) {
+		if (!err) start();
+	}
+};
+
+
+void minerApi::acceptLocal() {
+	auto session = std::make_shared<localSession>(io_service, this);
+	localAcceptor.async_accept(session->socket, [this, session](const boost::system::error_code& err) {
+		if (!err) session->start();
+		acceptLocal();
+	});
+}
+#endif
+
+
+void minerApi::acceptHttp() {
+	auto session = std::make_shared<httpSession>(io_service, this);
+	acceptor.async_accept(session->socket, [this, session](const boost::system::error_code& err) {
+		if (!err) session->start();
+		acceptHttp();
+	});
+}
+
+
+string minerApi::statusJson() {
+	vector<deviceStatus> devices = host->getStatus();
+
+	stringstream json;
+	json << std::fixed << std::setprecision(3);
+	json << "{\"devices\":[";
+	for (uint32_t i=0; i<devices.size(); i++) {
+		deviceStatus &d = devices[i];
+		json << ((i > 0) ? "," : "") << "{\"id\":" << d.id << ",\"name\":\"" << escape(d.name) << "\",\"group\":" << d.group
+		     << ",\"paused\":" << (d.userPaused ? "true" : "false") << ",\"idle\":" << (d.idle ? "true" : "false")
+		     << ",\"failed\":" << (d.failed ? "true" : "false") << ",\"quarantined\":" << (d.quarantined ? "true" : "false")
+		     << ",\"recoveries\":" << d.recoveries << ",\"lastError\":" << d.lastError
+		     << ",\"solPerSec\":" << d.solPerSec << ",\"iterationMs\":" << d.iterationMs << ",\"hostUsPerIteration\":" << d.hostUsPerIteration
+		     << ",\"jobSwitchMs\":" << d.switchMs << ",\"solutions\":" << d.solutions << ",\"iterations\":" << d.iterations
+		     << ",\"solPerSecEwma\":" << d.rates.ewma << ",\"accepted\":" << d.rates.accepted << ",\"rejected\":" << d.rates.rejected;
+		for (uint32_t kind=0; kind<2; kind++) {
+			json << ((kind == 0) ? ",\"solutionRate\":{" : ",\"effectiveRate\":{");
+			for (uint32_t w=0; w<statWindows; w++) {
+				rateEstimate &r = (kind == 0) ? d.rates.solutions[w] : d.rates.effective[w];
+				json << ((w > 0) ? "," : "") << "\"" << windowName(w) << "\":{\"rate\":" << r.rate << ",\"low\":" << r.low << ",\"high\":" << r.high << "}";
+			}
+			json << "}";
+		}
+		json << "}";
+	}
+
+	json << "],\"batch\":" << host->maxBatchSize() << ",\"groups\":[";
+	for (uint32_t g=0; g<stratums.size(); g++) {
+		stratumStatus s = stratums[g]->getStatus();
+		json << ((g > 0) ? "," : "") << "{\"group\":" << g << ",\"uptime\":" << s.uptimeSec << ",\"jobId\":" << s.workId
+		     << ",\"difficulty\":" << s.difficulty << ",\"accepted\":" << s.accepted << ",\"rejected\":" << s.rejected
+		     << ",\"stale\":" << s.stale;
+		const noncePartition &np = s.partition;
+		json << ",\"nonce\":{\"partitioned\":" << (np.partitioned ? "true" : "false") << ",\"prefixBits\":" << np.prefixBits
+		     << ",\"instance\":" << np.instance << ",\"instanceBits\":" << np.instanceBits << ",\"leaseSlot\":" << np.leaseSlot
+		     << ",\"deviceBits\":" << np.deviceBits << ",\"counterBits\":" << np.counterBits << "}";
+		json << ",\"pools\":[";
+		for (uint32_t p=0; p<s.pools.size(); p++) {
+			poolStatus &ps = s.pools[p];
+			json << ((p > 0) ? "," : "") << "{\"pool\":" << p << ",\"name\":\"" << escape(ps.name) << "\",\"connected\":" << (ps.loggedIn ? "true" : "false")
+			     << ",\"active\":" << (ps.active ? "true" : "false") << ",\"rttMs\":" << ps.rttMs << ",\"jobDelayMs\":" << ps.jobDelayMs << "}";
+		}
+		json << "]}";
+	}
+	json << "]}";
+	return json.str();
+}
+
+
+string minerApi::metricsText() {
+	vector<deviceStatus> devices = host->getStatus();
+	stringstream out;
+	out << std::fixed << std::setprecision(6);
+
+	auto header = [&out](const char* name, const char* type, const char* help) {
+		out << "# HELP " << name << " " << help << "\n# TYPE " << name << " " << type << "\n";
+	};
+	auto device = [](const deviceStatus& d) {
+		return "{device=\"" + to_string(d.id) + "\",group=\"" + to_string(d.group) + "\",name=\"" + escape(d.name) + "\"}";
+	};
+
+	header("hds_device_solutions_per_second", "gauge", "Solutions per second over the last statistics interval");
+	for (auto &d : devices) out << "hds_device_solutions_per_second" << device(d) << " " << d.solPerSec << "\n";
+	header("hds_device_solutions_per_second_ewma", "gauge", "Solutions per second, smoothed with a one minute time constant");
+	for (auto &d : devices) out << "hds_device_solutions_per_second_ewma" << device(d) << " " << d.rates.ewma << "\n";
+
+	// Windowed rates with the bounds of their 95% confidence interval
+	const char* rateNames[2] = {"hds_device_solution_rate", "hds_device_effective_rate"};
+	const char* rateHelp[2] = {"Solutions per second over the window", "Difficulty of accepted shares per second over the window, in solutions per second"};
+	for (uint32_t kind=0; kind<2; kind++) {
+		for (const char* bound : {"", "_low", "_high"}) {
+			string name = string(rateNames[kind]) + bound;
+			header(name.c_str(), "gauge", rateHelp[kind]);
+			for (auto &d : devices) {
+				for (uint32_t w=0; w<statWindows; w++) {
+					rateEstimate &r = (kind == 0) ? d.rates.solutions[w] : d.rates.effective[w];
+					double value = (bound[0] == 0) ? r.rate : ((bound[1] == 'l') ? r.low : r.high);
+					string labels = device(d);
+					labels.insert(labels.size() - 1, ",window=\"" + windowName(w) + "\"");
+					out << name << labels << " " << value << "\n";
+				}
+			}
+		}
+	}
+
+	header("hds_device_iteration_seconds", "gauge", "Wall time per solver iteration");
+	for (auto &d : devices) out << "hds_device_iteration_seconds" << device(d) << " " << d.iterationMs / 1000.0 << "\n";
+	header("hds_device_host_seconds_per_iteration", "gauge", "Host time in the launch callback per iteration");
+	for (auto &d : devices) out << "hds_device_host_seconds_per_iteration" << device(d) << " " << d.hostUsPerIteration / 1e6 << "\n";
+	header("hds_device_job_switch_seconds", "gauge", "Time from a new job until the first kernel for it");
+	for (auto &d : devices) out << "hds_device_job_switch_seconds" << device(d) << " " << d.switchMs / 1000.0 << "\n";
+	header("hds_device_solutions_total", "counter", "Solutions found by the device");
+	for (auto &d : devices) out << "hds_device_solutions_total" << device(d) << " " << d.solutions << "\n";
+	header("hds_device_shares_total", "counter", "Answered shares of the device");
+	for (auto &d : devices) {
+		string labels = device(d);
+		out << "hds_device_shares_total" << labels.substr(0, labels.size() - 1) << ",result=\"accepted\"} " << d.rates.accepted << "\n";
+		out << "hds_device_shares_total" << labels.substr(0, labels.size() - 1) << ",result=\"rejected\"} " << d.rates.rejected << "\n";
+	}
+	header("hds_device_iterations_total", "counter", "Solver iterations run by the device");
+	for (auto &d : devices) out << "hds_device_iterations_total" << device(d) << " " << d.iterations << "\n";
+	header("hds_device_paused", "gauge", "1 if the device was paused through the API");
+	for (auto &d : devices) out << "hds_device_paused" << device(d) << " " << (d.userPaused ? 1 : 0) << "\n";
+	header("hds_device_recoveries_total", "counter", "Resets of the device after a failed or overdue launch");
+	for (auto &d : devices) out << "hds_device_recoveries_total" << device(d) << " " << d.recoveries << "\n";
+	header("hds_device_quarantined", "gauge", "1 if the device failed too often and is left alone for a while");
+	for (auto &d : devices) out << "hds_device_quarantined" << device(d) << " " << (d.quarantined ? 1 : 0) << "\n";
+
+	vector<stratumStatus> groups;
+	for (auto &stratum : stratums) groups.push_back(stratum->getStatus());
+
+	header("hds_shares_total", "counter", "Solutions by the answer of the pool, stale ones were not submitted");
+	for (uint32_t g=0; g<groups.size(); g++) {
+		out << "hds_shares_total{group=\"" << g << "\",result=\"accepted\"} " << groups[g].accepted << "\n";
+		out << "hds_shares_total{group=\"" << g << "\",result=\"rejected\"} " << groups[g].rejected << "\n";
+		out << "hds_shares_total{group=\"" << g << "\",result=\"stale\"} " << groups[g].stale << "\n";
+	}
+	header("hds_pool_rtt_seconds", "gauge", "Smoothed round trip time of stratum requests");
+	for (uint32_t g=0; g<groups.size(); g++) {
+		for (auto &p : groups[g].pools) out << "hds_pool_rtt_seconds{group=\"" << g << "\",pool=\"" << escape(p.name) << "\"} " << p.rttMs / 1000.0 << "\n";
+	}
+	header("hds_pool_connected", "gauge", "1 if the miner is logged in at the pool");
+	for (uint32_t g=0; g<groups.size(); g++) {
+		for (auto &p : groups[g].pools) out << "hds_pool_connected{group=\"" << g << "\",pool=\"" << escape(p.name) << "\"} " << (p.loggedIn ? 1 : 0) << "\n";
+	}
+	header("hds_pool_active", "gauge", "1 for the pool the devices of the group mine for");
+	for (uint32_t g=0; g<groups.size(); g++) {
+		for (auto &p : groups[g].pools) out << "hds_pool_active{group=\"" << g << "\",pool=\"" << escape(p.name) << "\"} " << (p.active ? 1 : 0) << "\n";
+	}
+	header("hds_uptime_seconds", "gauge", "Time since the miner started");
+	out << "hds_uptime_seconds " << ((groups.size() > 0) ? groups[0].uptimeSec : 0) << "\n";
+
+	return out.str();
+}
+
+
+// Runs on the API thread
+apiReply minerApi::handleRequest(const string& method, const pt::ptree& params, bool control) {
+	apiReply reply;
+
+	if (method == "status") {
+		reply.body = statusJson();
+		return reply;
+	}
+
+	if (method == "metrics") {
+		reply.contentType = "text/plain; version=0.0.4";
+		reply.body = metricsText();
+		return reply;
+	}
+
+	if (!isControl(method)) {
+		reply.status = 404;
+		reply.body = "{\"error\":\"unknown method\"}";
+		return reply;
+	}
+
+	if (!control) {
+		reply.status = 403;
+		reply.body = "{\"error\":\"control commands are only accepted from localhost\"}";
+		return reply;
+	}
+
+	bool ok = false;
+	try {
+		if ((method == "pause") || (method == "resume")) {
+			ok = host->pauseDevice(params.get<uint32_t>("device"), (method == "pause"));
+		} else if (method == "switch") {
+			uint32_t group = params.get<uint32_t>("group", 0);
+			ok = (group < stratums.size()) && stratums[group]->requestSwitch(params.get<uint32_t>("pool"));
+		} else if (method == "tune") {
+			ok = host->setBatchSize(params.get<uint32_t>("batch"));
+		}
+	} catch (const pt::ptree_error &e) {
+		ok = false;
+	}
+
+	if (ok) {
+		reply.body = "{\"result\":\"ok\"}";
+	} else {
+		reply.status = 400;
+		reply.body = "{\"error\":\"invalid or missing parameter\"}";
+	}
+	return reply;
+}
+
+
+void minerApi::start() {
+	if (config.port > 0) acceptHttp();
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+	if (config.socketPath.size() > 0) acceptLocal();
+#endif
+
+	std::thread([this]() {
+		while (true) {
+			try {
+				io_service.run();
+				return;
+			} catch (std::exception const& e) {
+				HDS_LOG(logError) << "API error: " << e.what();
+				io_service.reset();
+			}
+		}
+	}).detach();
+}
+
+
+// Compares in constant time, the answer time tells nothing about the token
+bool minerApi::tokenMatches(const string& token) {
+	if (config.token.empty() || (token.size() != config.token.size())) return false;
+	uint8_t diff = 0;
+	for (size_t i=0; i<token.size(); i++) diff |= (uint8_t) (token[i] ^ config.token[i]);
+	return (diff == 0);
+}
+
+
+minerApi::minerApi(clHost* hostIn, std::vector<hdsStratum*> stratumsIn, apiConfig configIn) : acceptor(io_service)
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+	, localAcceptor(io_service)
+#endif
+	{
+	host = hostIn;
+	stratums = stratumsIn;
+	config = configIn;
+
+	if (config.port > 0) {
+		tcp::endpoint endpoint(boost::asio::ip::make_address(config.address), config.port);
+		acceptor.open(endpoint.protocol());
+		acceptor.set_option(tcp::acceptor::reuse_address(true));
+		acceptor.bind(endpoint);
+		acceptor.listen();
+		HDS_LOG(logInfo) << "API listening on " << config.address << ":" << config.port;
+		if (config.token.empty()) HDS_LOG(logInfo) << "API: control commands over HTTP are off, they need --apiToken";
+	}
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+	if (config.socketPath.size() > 0) {
+		::unlink(config.socketPath.c_str());
+		boost::asio::local::stream_protocol::endpoint endpoint(config.socketPath);
+		localAcceptor.open(endpoint.protocol());
+		localAcceptor.bind(endpoint);
+		localAcceptor.listen();
+		HDS_LOG(logInfo) << "API listening on " << config.socketPath;
+	}
+#else
+	if (config.socketPath.size() > 0) HDS_LOG(logWarning) << "Warning: Unix sockets are not supported on this system, --apiSocket is ignored";
+#endif
+}
+
+}
@@ -0,0 +1,80 @@
+// HDS OpenCL Miner
+// Metrics and control API
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <algorithm>
+
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "clHost.h"
+#include "hdsStratum.h"
+
+#ifndef minerApi_H
+#define minerApi_H
+
+using namespace std;
+using boost::asio::ip::tcp;
+namespace pt = boost::property_tree;
+
+namespace hdsMiner {
+
+// Options of the API set from the command line
+struct apiConfig {
+	string address = "127.0.0.1";	// HTTP listen address
+	uint16_t port = 0;		// HTTP port, 0 = off
+	string socketPath;		// Unix socket, empty = off
+	string token;			// Shared secret for control commands over HTTP, empty = HTTP control off
+};
+
+// Answer to one API request
+struct apiReply {
+	int32_t status = 200;
+	string contentType = "application/json";
+	string body;
+};
+
+// Small server on its own thread. HTTP serves GET /metrics in the Prometheus text format and
+// GET /status as JSON, control commands are POST /pause, /resume, /switch and /tune with their
+// parameters in the query. The Unix socket takes one JSON request per line, like
+// {"method":"pause", "device":1}, and answers each with one line of JSON.
+// Control commands are only accepted from localhost with the X-Hds-Token header and from the Unix socket.
+class minerApi {
+	private:
+	clHost *host;
+	std::vector<hdsStratum*> stratums;
+	apiConfig config;
+
+	boost::asio::io_service io_service;
+	tcp::acceptor acceptor;
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+	boost::asio::local::stream_protocol::acceptor localAcceptor;
+	void acceptLocal();
+#endif
+	void acceptHttp();
+
+	string statusJson();
+	string metricsText();
+
+	public:
+	minerApi(clHost*, std::vector<hdsStratum*>, apiConfig);
+	void start();
+
+	apiReply handleRequest(const string&, const pt::ptree&, bool);
+	bool tokenMatches(const string&);
+};
+
+}
+
+#endif
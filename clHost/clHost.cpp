@@ -7,6 +7,30 @@
 
 namespace hdsMiner {
 
+// A launch is overdue after this many times its expected duration, but never before the minimum.
+// The first launch of a device has no expectation yet and gets the longer limit.
+const double watchdogFactor = 10.0;
+const int64_t watchdogMinMs = 5000;
+const int64_t watchdogFirstMs = 60000;
+
+// A device failing this often within the period is quarantined instead of being reset again
+const uint32_t quarantineFailures = 3;
+const std::chrono::minutes failurePeriod(10);
+const std::chrono::minutes quarantineTime(30);
+
+inline const char* solverName(solverType type) {
+	switch (type) {
+		case HdsI: return "HdsHash I";
+		case HdsII: return "HdsHash II";
+		case HdsIII: return "HdsHash III";
+		default: return "none";
+	}
+}
+
+inline int64_t steadyUs() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 // Helper functions to split a string
 inline vector<string> &split(const string &s, char delim, vector<string> &elems) {
     stringstream ss(s);
@@ -42,6 +66,9 @@ inline bool hasExtension(cl::Device &device, string extension) {
 // This function will be called every time a GPU is done with its current work
 void CL_CALLBACK CCallbackFunc(cl_event ev, cl_int err , void* data) {
 	clHost* self = static_cast<clHost*>(((clCallbackData*) data)->host);
+
+	// Launches the watchdog gave up on may still complete, they are no longer ours
+	if (!self->endLaunch(((clCallbackData*) data)->gpuIndex, ev)) return;
 	self->callbackFunc(err,data);
 }
 
@@ -84,7 +111,7 @@ void clHost::detectPlatFormDevices(vector<int32_t> selDev, bool allowCPU) {
 				name.pop_back();
 			} 
 			
-			cout << "Found device " << curDiv << ": " << name << endl;
+			HDS_LOG(logInfo) << "Found device " << curDiv << ": " << name;
 
 			// Check if the device should be selected
 			bool pick = false;
@@ -100,14 +127,23 @@ void clHost::detectPlatFormDevices(vector<int32_t> selDev, bool allowCPU) {
 			}
 
 			if (pick) {
-				cl_command_queue_properties queue_prop = 0;  
+				cl_command_queue_properties queue_prop = traceEnabled() ? CL_QUEUE_PROFILING_ENABLE : 0;
 				devices.push_back(nDev[di]);
+				deviceIds.push_back(curDiv);
+				deviceNames.push_back(name);
 				currentWork.push_back(clCallbackData());
-				deviceContext.push_back(pl);
+				deviceContexts.push_back(contexts[pl]);
 				events.push_back(cl::Event());
-				paused.push_back(false);
-				solutionCnt.push_back(0);
+				paused.emplace_back(false);
+				userPaused.emplace_back(false);
+				health.emplace_back();
+				staging.emplace_back();
 				queues.push_back(cl::CommandQueue(contexts[pl], devices[devices.size()-1], queue_prop, NULL)); 
+
+				// Own queue for the epoch, its writes need not wait for the running launch
+				epochValues.push_back(0);
+				epochBuffers.push_back(cl::Buffer(contexts[pl], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(cl_uint), &epochValues.back(), NULL));
+				epochQueues.push_back(cl::CommandQueue(contexts[pl], devices[devices.size()-1], 0, NULL));
 			}
 
 			curDiv++; 
@@ -115,106 +151,432 @@ void clHost::detectPlatFormDevices(vector<int32_t> selDev, bool allowCPU) {
 	}
 
 	if (devices.size() == 0) {
-		cout << "No compatible OpenCL devices found or all are deselected. Closing hdsMiner." << endl;
+		HDS_LOG(logInfo) << "No compatible OpenCL devices found or all are deselected. Closing hdsMiner.";
 		exit(0);
 	}
 
-	HdsHashI.setup(devices, contexts, deviceContext);
-	HdsHashII.setup(devices, contexts, deviceContext);
-	HdsHashIII.setup(devices, contexts, deviceContext);
+	// Only specs with per iteration buffers or batched launches make use of the batch size
+	for (hdsSolver* solver : {&HdsHashI, &HdsHashII, &HdsHashIII}) {
+		solver->setup(devices, deviceContexts);
+		solver->setEpochBuffers(epochBuffers);
+		solver->setBatchSize(config.batchSize);
+	}
 }
 
 
-// Setup function called from outside
-void clHost::setup(hdsStratum* stratumIn, vector<int32_t> devSel) {
-	stratum = stratumIn;
-	detectPlatFormDevices(devSel, false);
+// Setup function called from outside. Every group has its own stratum session and device selection,
+// all groups share the OpenCL contexts and compiled kernels. Only the first group may select all
+// devices (-1), it then gets the ones no other group selected.
+void clHost::setup(vector<hdsStratum*> stratumsIn, vector< vector<int32_t> > devSel, clHostConfig configIn) {
+	stratums = stratumsIn;
+	config = configIn;
+	if (config.batchSize > 1) config.devicePrePow = true;
+
+	vector<int32_t> allSel;
+	for (auto &sel : devSel) allSel.insert(allSel.end(), sel.begin(), sel.end());
+	sort(allSel.begin(), allSel.end());
+	allSel.erase(unique(allSel.begin(), allSel.end()), allSel.end());
+	if (allSel[0] == -1) allSel.assign(1, -1);
+
+	detectPlatFormDevices(allSel, config.allowCPU);
+
+	// Assign the devices to their groups, the index inside the group selects the nonce partition
+	vector<uint32_t> groupSize(stratums.size(), 0);
+	for (uint32_t i=0; i<devices.size(); i++) {
+		deviceGroup.push_back(0);
+		for (uint32_t g=devSel.size(); g-- > 1; ) {
+			if (find(devSel[g].begin(), devSel[g].end(), (int32_t) deviceIds[i]) != devSel[g].end()) deviceGroup[i] = g;
+		}
+
+		currentWork[i].wd.device = groupSize[deviceGroup[i]]++;
+		if (stratums.size() > 1) HDS_LOG(logInfo) << "Device " << deviceIds[i] << " mines for group " << deviceGroup[i];
+	}
+
+	status.resize(devices.size());
+	for (uint32_t i=0; i<devices.size(); i++) {
+		status[i].id = deviceIds[i];
+		status[i].group = deviceGroup[i];
+		status[i].name = deviceNames[i];
+	}
+	launchBatch = config.batchSize;
+	stats.setup(devices.size());
+	launchTraceUs.assign(devices.size(), 0);
+	for (uint32_t i=0; i<devices.size(); i++) traceDeviceName(i, "Device " + to_string(deviceIds[i]) + ": " + deviceNames[i]);
+
+	for (uint32_t g=0; g<stratums.size(); g++) {
+		if (groupSize[g] == 0) HDS_LOG(logWarning) << "Warning: no device found for group " << g;
+		stratums[g]->setDeviceCount(groupSize[g]);
+		stratums[g]->setJobListener(std::bind(&clHost::onNewJob, this, g, std::placeholders::_1));
+		stratums[g]->setDeviceShareListener(std::bind(&clHost::onShareResult, this, g, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+	}
 }
 
 
+// Called from the stratum thread of a group with the device index inside the group and the difficulty of an answered share
+void clHost::onShareResult(uint32_t group, uint32_t device, double difficulty, bool accepted) {
+	for (uint32_t i=0; i<devices.size(); i++) {
+		if ((deviceGroup[i] == group) && (currentWork[i].wd.device == device)) stats.addShare(i, difficulty, accepted);
+	}
+}
 
-// this function will sumit the solutions done on GPU, then fetch new work and restart mining
-void clHost::callbackFunc(cl_int err , void* data){
-	clCallbackData* workInfo = (clCallbackData*) data;
-	uint32_t gpu = workInfo->gpuIndex;
 
-	hdsSolver * activeSolver;
-	switch (workInfo->currentSolver) {
+// Called from the stratum thread of a group with the oldest epoch still worth mining, running kernels of older
+// jobs see the change and skip their remaining iterations. Paused devices start right away instead of waiting
+// for the next statistics round.
+void clHost::onNewJob(uint32_t group, uint64_t epoch) {
+	{
+		boost::mutex::scoped_lock lock(epochMutex);
+		for (uint32_t i=0; i<epochQueues.size(); i++) {
+			if (deviceGroup[i] != group) continue;
+			epochValues[i] = (uint32_t) epoch;
+			epochQueues[i].enqueueWriteBuffer(epochBuffers[i], CL_FALSE, 0, sizeof(cl_uint), &epochValues[i]);
+			epochQueues[i].flush();
+		}
+	}
+
+	if (!mining) return;
+	for (uint32_t i=0; i<devices.size(); i++) {
+		if (deviceGroup[i] == group) resumeDevice(i);
+	}
+}
+
+
+
+// Puts the kernels of the finished launch on the timeline of the device. Device timestamps are
+// moved to the trace clock by aligning the queue time of the first kernel with the host time of the launch.
+void clHost::traceKernels(uint32_t gpu, hdsSolver * solver) {
+	vector<kernelTiming> timings = solver->takeKernelTimings(gpu);
+	if (timings.empty()) return;
+
+	int64_t offset = launchTraceUs[gpu] - (int64_t) (timings[0].queued / 1000);
+	for (auto &t : timings) {
+		if (t.end < t.start) continue;
+		traceDeviceSpan(gpu, t.name.c_str(), (int64_t) (t.start / 1000) + offset, (int64_t) ((t.end - t.start) / 1000));
+	}
+}
+
+
+// Maps a solver type to the solver implementing it, NULL for None
+hdsSolver * clHost::getSolver(solverType type) {
+	switch (type) {
 		case HdsI:
-			activeSolver = &HdsHashI;
-			break;
+			return &HdsHashI;
 
 		case HdsII:
-			activeSolver = &HdsHashII;
-			break;
+			return &HdsHashII;
 
 		case HdsIII:
-			activeSolver = &HdsHashIII;
-			break;
+			return &HdsHashIII;
+
+		default:
+			return NULL;
+	}
+}
 
-		case None: 
-			paused[gpu] = true;
-			return;
+
+// Fetch work and start the device. Buffers that are still allocated from before
+// a pause are reused when the solver did not change meanwhile, at a fork the new
+// solver takes the buffers it was prepared with.
+void clHost::startDevice(uint32_t gpu) {
+	if (userPaused[gpu] || health[gpu].failed) {
+		paused[gpu] = true;
+		return;
+	}
+
+	solverType nextSolver;
+	currentWork[gpu].wd.iterations = launchBatch;
+	{
+		traceScope span("getWork", "host");
+		stratumOf(gpu)->getWork(currentWork[gpu].wd, &nextSolver);
+	}
+
+	hdsSolver * activeSolver = getSolver(nextSolver);
+	if (activeSolver == NULL) {
+		paused[gpu] = true;
+		return;
+	}
+
+	solverStaging &s = staging[gpu];
+	solverType switchedFrom = None;
+	if (nextSolver != currentWork[gpu].currentSolver) {
+		finishWarmup(gpu);
+		s.switchPrepared = (s.solver == nextSolver) && !s.cold && activeSolver->hasBuffers(gpu);
+		s.solver = None;
+		s.cold = false;
+
+		hdsSolver * oldSolver = getSolver(currentWork[gpu].currentSolver);
+		if (oldSolver != NULL) oldSolver->releaseBuffers(gpu);
+		switchedFrom = currentWork[gpu].currentSolver;
+		currentWork[gpu].currentSolver = nextSolver;
+	}
+
+	if (!activeSolver->hasKernels(gpu)) {
+		deviceFailed(gpu, "kernels not built", CL_BUILD_PROGRAM_FAILURE);
+		return;
+	}
+
+	cl_int err = CL_SUCCESS;
+	if (!activeSolver->hasBuffers(gpu)) {
+		err = activeSolver->createBuffers(deviceContexts[gpu], gpu);
+	}
+	if (err != CL_SUCCESS) {
+		deviceFailed(gpu, "buffer allocation failed", err);
+		return;
+	}
+
+	s.warmupLaunch = prestageSolver(gpu);
+
+	traceScope span("enqueue", "host");
+	if (span.enabled()) {
+		span.args = "\"device\":" + to_string(deviceIds[gpu]) + ",\"workId\":" + to_string(currentWork[gpu].wd.workId);
+		launchTraceUs[gpu] = traceNow();
+	}
+
+	deviceHealth &h = health[gpu];
+	h.launchStartUs = steadyUs();
+	err = activeSolver->queueKernels(&queues[gpu], gpu, &events[gpu], &currentWork[gpu]);
+	h.launchIterations = max<uint32_t>(currentWork[gpu].wd.iterations, 1);
+
+	// Time without hashing from the last launch of the old solver until the new one is queued
+	s.switchLaunch = (switchedFrom != None) && (err == CL_SUCCESS);
+	if (s.switchLaunch) {
+		s.switchedFrom = switchedFrom;
+		s.switchGapMs = (double) (steadyUs() - s.launchEndUs) / 1000.0;
+	}
+
+	// The launch must be registered before the callback can run
+	if (err == CL_SUCCESS) {
+		h.launch = events[gpu]();
+		err = events[gpu].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[gpu]);
+	}
+	if (err != CL_SUCCESS) {
+		deviceFailed(gpu, "enqueue failed", err);
+		return;
+	}
+	queues[gpu].flush();
+}
+
+
+// Prepares the solver of the coming fork while the current one keeps mining. Its buffers are allocated
+// next to the current ones when the device memory holds both, and one warm-up launch is queued ahead of
+// the next mining launch, so the first launch after the fork neither allocates nor runs the kernels
+// for the first time. The kernels of all solvers are built at the start already. Returns true when
+// a warm-up was queued.
+bool clHost::prestageSolver(uint32_t gpu) {
+	solverStaging &s = staging[gpu];
+	solverType current = currentWork[gpu].currentSolver;
+	solverType next = currentWork[gpu].wd.nextSolver;
+	if (next == current) next = None;
+	if (next == s.solver) return false;
+
+	// The fork is no longer ahead, for example after a pool switch, the memory is given back
+	finishWarmup(gpu);
+	hdsSolver * staged = getSolver(s.solver);
+	if (staged != NULL) staged->releaseBuffers(gpu);
+	s.solver = next;
+	s.cold = false;
+
+	staged = getSolver(next);
+	if (staged == NULL) return false;
+
+	s.cold = true;
+	if (!staged->hasKernels(gpu)) return false;
+
+	// Checked before allocating, drivers may accept an oversubscription and fail or page at the first launch
+	hdsSolver * active = getSolver(current);
+	uint64_t needed = ((active != NULL) ? active->bufferBytes(gpu) : 0) + staged->plannedBytes();
+	uint64_t memory = devices[gpu].getInfo<CL_DEVICE_GLOBAL_MEM_SIZE>();
+	uint64_t available = memory - memory * stagingHeadroomPercent / 100;
+	uint64_t maxAlloc = devices[gpu].getInfo<CL_DEVICE_MAX_MEM_ALLOC_SIZE>();
+	if ((needed > available) || (staged->largestPlannedBuffer() > maxAlloc)) {
+		HDS_LOG(logWarning) << "Device " << deviceIds[gpu] << ": " << solverName(next) << " does not fit next to " << solverName(current)
+		                    << " (" << (needed >> 20) << " of " << (available >> 20) << " MB, largest buffer " << (staged->largestPlannedBuffer() >> 20)
+		                    << " of " << (maxAlloc >> 20) << " MB), it starts cold at the fork";
+		return false;
+	}
+
+	cl_int err = staged->createBuffers(deviceContexts[gpu], gpu);
+	if (err != CL_SUCCESS) {
+		staged->releaseBuffers(gpu);
+		HDS_LOG(logWarning) << "Device " << deviceIds[gpu] << ": buffers of " << solverName(next) << " failed (OpenCL error " << err << "), it starts cold at the fork";
+		return false;
+	}
+
+	s.work = currentWork[gpu];
+	s.work.currentSolver = next;
+	s.work.wd.iterations = 1;
+	err = staged->queueKernels(&queues[gpu], gpu, &s.warmup, &s.work);
+	if (err != CL_SUCCESS) {
+		staged->releaseBuffers(gpu);
+		HDS_LOG(logWarning) << "Device " << deviceIds[gpu] << ": warm-up of " << solverName(next) << " failed (OpenCL error " << err << "), it starts cold at the fork";
+		return false;
+	}
+
+	s.cold = false;
+	s.warmupPending = true;
+	HDS_LOG(logInfo) << "Device " << deviceIds[gpu] << ": " << solverName(next) << " prepared for the fork, " << (staged->bufferBytes(gpu) >> 20) << " MB allocated";
+	return true;
+}
+
+
+// Takes the results of the warm-up launch back. The queue is in order and the warm-up ran ahead of a
+// launch that has completed since, so this does not wait. A failed warm-up leaves a cold switch.
+void clHost::finishWarmup(uint32_t gpu) {
+	solverStaging &s = staging[gpu];
+	if (!s.warmupPending) return;
+	s.warmupPending = false;
+
+	hdsSolver * staged = getSolver(s.solver);
+	cl_int status = CL_COMPLETE;
+	s.warmup.wait();
+	s.warmup.getInfo(CL_EVENT_COMMAND_EXECUTION_STATUS, &status);
+	staged->takeKernelTimings(gpu);
+	staged->unmapResult(&queues[gpu], gpu);
+
+	if (status != CL_COMPLETE) {
+		staged->releaseBuffers(gpu);
+		s.cold = true;
+		HDS_LOG(logWarning) << "Device " << deviceIds[gpu] << ": warm-up of " << solverName(s.solver) << " failed (OpenCL error " << status << "), it starts cold at the fork";
+	}
+}
+
+
+// Claims the end of the running launch for the callback, false if the watchdog already gave up on it
+bool clHost::endLaunch(uint32_t gpu, cl_event ev) {
+	return health[gpu].launch.compare_exchange_strong(ev, nullptr);
+}
+
+
+// Stops the device until the watchdog reset it. The flag is set before the pause, so a concurrent
+// resume that sees the pause also sees the failure.
+void clHost::deviceFailed(uint32_t gpu, const char* reason, cl_int err) {
+	deviceHealth &h = health[gpu];
+	h.launch = nullptr;
+	h.lastError = err;
+	h.reason = reason;
+	bool wasFailed = h.failed.exchange(true);
+	paused[gpu] = true;
+	if (wasFailed) return;
+
+	logLine line(logError);
+	line << "Device " << deviceIds[gpu] << ": " << reason;
+	if (err != CL_SUCCESS) line << " (OpenCL error " << err << ")";
+}
+
+
+// Restart a paused device, safe to call from any thread
+void clHost::resumeDevice(uint32_t gpu) {
+	bool wasPaused = true;
+	if (!userPaused[gpu] && stratumOf(gpu)->hasWork() && paused[gpu].compare_exchange_strong(wasPaused, false)) {
+		startDevice(gpu);
+	}
+}
+
+
+// this function will sumit the solutions done on GPU, then fetch new work and restart mining
+void clHost::callbackFunc(cl_int err , void* data){
+	clCallbackData* workInfo = (clCallbackData*) data;
+	uint32_t gpu = workInfo->gpuIndex;
+
+	// The status of the event, negative when the launch was aborted
+	if (err != CL_COMPLETE) {
+		deviceFailed(gpu, "launch failed", err);
+		return;
+	}
+
+	hdsSolver * activeSolver = getSolver(workInfo->currentSolver);
+	if (activeSolver == NULL) {
+		paused[gpu] = true;
+		return;
+	}
+
+	auto hostStart = std::chrono::steady_clock::now();
+	deviceHealth &h = health[gpu];
+	solverStaging &s = staging[gpu];
+	s.launchEndUs = steadyUs();
+	double launchMs = (double) (s.launchEndUs - h.launchStartUs) / 1000.0;
+
+	if (s.switchLaunch) {
+		s.switchLaunch = false;
+		HDS_LOG(logInfo) << "Device " << deviceIds[gpu] << ": switched from " << solverName(s.switchedFrom) << " to " << solverName(workInfo->currentSolver)
+		                 << (s.switchPrepared ? " (prepared)" : " (cold)") << ", hashing gap " << logPrecision(1) << s.switchGapMs
+		                 << " ms, first launch " << launchMs << " ms";
+	}
+	uint32_t skipped = 0;
+
+	traceScope span("callback", "host");
+	if (span.enabled()) {
+		static thread_local bool named = false;
+		if (!named) traceThreadName("OpenCL callback");
+		named = true;
+		span.args = "\"device\":" + to_string(deviceIds[gpu]);
+		traceKernels(gpu, activeSolver);
 	}
 
 	uint32_t * results = activeSolver->getResults(gpu);
 	
-	// Read the number of solutions of the last iteration
-	uint32_t solutions = results[0];
-	//cout << solutions << endl;
-	solutions = min<uint32_t>(solutions, 10);
+	// Every iteration of the last launch has its own slot in the results
+	uint32_t iterations = max<uint32_t>(workInfo->wd.iterations, 1);
+	WorkDescription slotWork = workInfo->wd;
+	uint64_t lastEpoch = workInfo->wd.epoch;
+
+	for (uint32_t it=0; it<iterations; it++) {
+		uint32_t * slot = &results[it * resultSlotSize];
+		slotWork.nonce = workInfo->wd.nonce + it * workInfo->wd.nonceStep;
+
+		if (slot[1] != 0) {
+			stats.device(gpu).skipped.fetch_add(1, std::memory_order_relaxed);
+			skipped++;
+			continue;
+		}
 
-	for (uint32_t  i=0; i<solutions; i++) {
-		vector<uint32_t> indexes;
-		indexes.assign(32,0);
-		memcpy(indexes.data(), &results[4 + 32*i], sizeof(uint32_t) * 32);
+		// Read the number of solutions of the iteration
+		uint32_t solutions = slot[0];
+		//cout << solutions << endl;
+		solutions = min<uint32_t>(solutions, 10);
 
-		stratum->handleSolution(workInfo->wd,indexes);
+		vector< vector<uint32_t> > found(solutions);
+		for (uint32_t  i=0; i<solutions; i++) {
+			found[i].assign(32,0);
+			memcpy(found[i].data(), &slot[4 + 32*i], sizeof(uint32_t) * 32);
+		}
+		stratumOf(gpu)->handleSolutions(slotWork,found);
+
+		stats.device(gpu).solutions.fetch_add(solutions, std::memory_order_relaxed);
 	}
 
-	solutionCnt[gpu] += solutions;
+	stats.device(gpu).iterations.fetch_add(iterations, std::memory_order_relaxed);
+	activeSolver->unmapResult(&queues[gpu], gpu);
 
-	// Get new work and resume working
-	if (stratum->hasWork()) {
-
-		activeSolver->unmapResult(&queues[gpu], gpu);
-
-		// Get a new set of work from the stratum interface
-		solverType nextSolver;
-		stratum->getWork(workInfo->wd, &nextSolver);
-		
-		if (nextSolver != workInfo->currentSolver) {
-			activeSolver->stop(gpu); 
-			workInfo->currentSolver = nextSolver;
-
-			switch (workInfo->currentSolver) {
-				case HdsI:
-					activeSolver = &HdsHashI;
-					break;
-
-				case HdsII:
-					activeSolver = &HdsHashII;
-					break;
-
-				case HdsIII:
-					activeSolver = &HdsHashIII;
-					break;
-
-				case None: 
-					paused[gpu] = true;
-					return;
-			}
+	// Launches cut short by a new job would make the expectation too low, one behind a warm-up too high
+	if ((skipped == 0) && !s.warmupLaunch) {
+		double perIt = launchMs / (double) iterations;
+		double expected = h.iterationMs;
+		h.iterationMs = (expected > 0) ? 0.8 * expected + 0.2 * perIt : perIt;
+	}
 
-			activeSolver->createBuffers(contexts[deviceContext[gpu]], devices[gpu], gpu);
+	// Get new work and resume working
+	if (stratumOf(gpu)->hasWork()) {
+		startDevice(gpu);
+
+		auto hostEnd = std::chrono::steady_clock::now();
+		deviceCounters &counters = stats.device(gpu);
+		counters.hostTimeUs.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(hostEnd - hostStart).count(), std::memory_order_relaxed);
+
+		// Time from receiving a job until this device enqueued its first kernel for it
+		if (workInfo->wd.epoch != lastEpoch) {
+			uint64_t switchUs = std::chrono::duration_cast<std::chrono::microseconds>(hostEnd - workInfo->wd.jobReceived).count();
+			counters.switches.fetch_add(1, std::memory_order_relaxed);
+			counters.switchTimeUs.fetch_add(switchUs, std::memory_order_relaxed);
+			if (switchUs > counters.switchMaxUs.load(std::memory_order_relaxed)) counters.switchMaxUs.store(switchUs, std::memory_order_relaxed);
 		}
-		
-		activeSolver->queueKernels(&queues[gpu], gpu, &events[gpu], workInfo);
-		events[gpu].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[gpu]);
-		queues[gpu].flush();
 	} else {
-		activeSolver->stop(gpu); 
+		// The buffers stay allocated, so the device is back to work instantly
 		paused[gpu] = true;
-		cout << "Device will be paused, waiting for new work" << endl;
+		HDS_LOG(logInfo) << "Device will be paused, waiting for new work";
+
+		// Work might have arrived meanwhile
+		resumeDevice(gpu);
 	}
 }
 
@@ -222,102 +584,249 @@ void clHost::callbackFunc(cl_int err , void* data){
 void clHost::startMining() {
 
 	// Start mining initially
-	for (int i=0; i<devices.size(); i++) {	
+	for (uint32_t i=0; i<devices.size(); i++) {	
 		paused[i] = false;
 
 		currentWork[i].gpuIndex = i;
 		currentWork[i].host = (void*) this;
-		//queueKernels(i, &currentWork[i]);
+		currentWork[i].wd.devicePrePow = config.devicePrePow;
+
+		startDevice(i);
+	}
+
+	mining = true;
+
+	// While the mining is running watch the devices and print some statistics
+	uint64_t round = 0;
+	while (restart) {
+		for (uint32_t tick=0; tick<15; tick++) {
+			this_thread::sleep_for(std::chrono::seconds(1));
+			checkDevices();
+		}
+
+		vector<deviceInterval> intervals = stats.takeSample();
+		vector<deviceRates> rates(devices.size());
+		for (uint32_t i=0; i<devices.size(); i++) rates[i] = stats.getRates(i);
+		round++;
+
+		// Print the smoothed performance, the rate of a single interval is too noisy
+		{
+			double totalRate = 0;
+			vector<double> groupRate(stratums.size(), 0.0);
+			logLine line(logInfo);
+			line << "Performance: ";
+			for (uint32_t i=0; i<devices.size(); i++) {
+				totalRate += rates[i].ewma;
+				groupRate[deviceGroup[i]] += rates[i].ewma;
+				line << logPrecision(2) << rates[i].ewma << " sol/s ";
+			}
+
+			if (devices.size() > 1) line << "| Total: " << totalRate << " sol/s ";
+			if (stratums.size() > 1) {
+				for (uint32_t g=0; g<stratums.size(); g++) line << "| Group " << g << ": " << groupRate[g] << " sol/s ";
+			}
+		}
+
+		// Once a minute the windowed rates with their 95% intervals. A card whose effective rate stays
+		// below its solution rate beyond the intervals loses shares, otherwise it is luck.
+		if (round % 4 == 0) {
+			for (uint32_t i=0; i<devices.size(); i++) {
+				logLine line(logInfo);
+				line << "Device " << deviceIds[i] << ": " << logPrecision(2);
+				for (uint32_t w=0; w<statWindows; w++) {
+					rateEstimate &r = rates[i].solutions[w];
+					line << ((statWindowSec[w] < 3600) ? statWindowSec[w] / 60 : statWindowSec[w] / 3600) << ((statWindowSec[w] < 3600) ? " min " : " h ")
+					     << r.rate << " (" << r.low << "-" << r.high << ") ";
+				}
+				rateEstimate &e = rates[i].effective[1];
+				line << "sol/s, effective 15 min " << e.rate << " (" << e.low << "-" << e.high << ") sol/s, shares " << rates[i].accepted << " / " << rates[i].rejected;
+			}
+		}
+
+		// Host time spent per iteration in the callback, shows the effect of the batch size
+		{
+			boost::mutex::scoped_lock lock(statusMutex);
+			for (uint32_t i=0; i<devices.size(); i++) {
+				deviceInterval &in = intervals[i];
+				double perIt = (in.iterations > 0) ? (double) in.hostTimeUs / (double) in.iterations : 0.0;
+				double switchMs = (in.switches > 0) ? (double) in.switchTimeUs / (1000.0 * in.switches) : 0.0;
+
+				if (config.debug) {
+					HDS_LOG(logDebug) << "Device " << i << ": batch " << launchBatch << ", host time " << logPrecision(1) << perIt 
+					                  << " us/iteration, " << in.skipped << " iterations skipped for new jobs";
+
+					if (in.switches > 0) {
+						HDS_LOG(logDebug) << "Device " << i << ": job to first kernel " << logPrecision(2) << switchMs
+						                  << " ms average, " << (double) in.switchMaxUs / 1000.0 << " ms max (" << in.switches << " jobs)";
+					}
+				}
+
+				status[i].solPerSec = (in.seconds > 0) ? (double) in.solutions / in.seconds : 0.0;
+				status[i].rates = rates[i];
+				status[i].iterationMs = (in.iterations > 0) ? 1000.0 * in.seconds / (double) in.iterations : 0.0;
+				status[i].hostUsPerIteration = perIt;
+				if (in.switches > 0) status[i].switchMs = switchMs;
+				status[i].solutions += in.solutions;
+				status[i].iterations += in.iterations;
+				status[i].userPaused = userPaused[i];
+				status[i].idle = paused[i] && !userPaused[i] && !health[i].failed;
+			}
+		}
+
+		// Check if there are paused devices and restart them
+		for (uint32_t i=0; i<devices.size(); i++) {
+			resumeDevice(i);
+		} 
+	} 
+}
 
-		solverType nextSolver;
-		stratum->getWork(currentWork[i].wd, &nextSolver);
 
-		hdsSolver * activeSolver;
-		switch (nextSolver) {
-			case HdsI:
-				activeSolver = &HdsHashI;
-				break;
+// Runs once a second from the statistics loop. Launches running much longer than expected are
+// given up and their device reset like one whose launch reported an error.
+void clHost::checkDevices() {
+	int64_t now = steadyUs();
+	for (uint32_t i=0; i<devices.size(); i++) {
+		deviceHealth &h = health[i];
 
-			case HdsII:
-				activeSolver = &HdsHashII;
-				break;
+		cl_event ev = h.launch;
+		if (ev != nullptr) {
+			double expected = h.iterationMs * (double) h.launchIterations;
+			int64_t limitMs = (expected > 0) ? max<int64_t>(watchdogMinMs, (int64_t) (watchdogFactor * expected)) : watchdogFirstMs;
+			if (((now - h.launchStartUs) / 1000 > limitMs) && h.launch.compare_exchange_strong(ev, nullptr)) {
+				deviceFailed(i, "launch overdue", CL_SUCCESS);
+			}
+		}
 
-			case HdsIII:
-				activeSolver = &HdsHashIII;
-				break;
+		if (!h.failed) continue;
 
-			case None: 
-				paused[i] = true;
-				break;
+		// The quarantine ends after its time or when the API resumes the device
+		if (h.quarantined) {
+			if (std::chrono::steady_clock::now() < h.quarantineEnd) continue;
+			h.quarantined = false;
+			HDS_LOG(logInfo) << "Device " << deviceIds[i] << ": quarantine over";
+		}
+		if (h.quarantineEnd != std::chrono::steady_clock::time_point()) {
+			h.failures.clear();
+			h.quarantineEnd = std::chrono::steady_clock::time_point();
 		}
 
-		currentWork[i].currentSolver = nextSolver;
+		recoverDevice(i);
+	}
+}
+
 
-		activeSolver->createBuffers(contexts[deviceContext[i]], devices[i], i);
-		activeSolver->queueKernels(&queues[i], i, &events[i], &currentWork[i]);
-		events[i].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[i]);
-		queues[i].flush();
+// Gives the device an own context and queue and builds the kernels again, the other devices of its
+// platform keep running. The old queue may still hold the hung launch and the old epoch queue a write
+// to the old flag, both are kept alive with the flag so neither can block or write into freed memory.
+void clHost::recoverDevice(uint32_t gpu) {
+	deviceHealth &h = health[gpu];
+	auto now = std::chrono::steady_clock::now();
+	h.failures.push_back(now);
+	while (now - h.failures.front() > failurePeriod) h.failures.pop_front();
+
+	if (h.failures.size() >= quarantineFailures) {
+		h.quarantineEnd = now + quarantineTime;
+		h.quarantined = true;
+		HDS_LOG(logError) << "Device " << deviceIds[gpu] << ": failed " << h.failures.size() << " times in " << failurePeriod.count()
+		                  << " minutes, quarantined for " << quarantineTime.count() << " minutes";
+		return;
 	}
 
+	cl_int err = CL_SUCCESS;
+	cl_command_queue_properties queue_prop = traceEnabled() ? CL_QUEUE_PROFILING_ENABLE : 0;
+	cl::Context context(devices[gpu], NULL, NULL, NULL, &err);
+	cl::CommandQueue queue;
+	cl::CommandQueue epochQueue;
+	cl::Buffer epochBuffer;
+	cl_uint epoch = 0;
+	{
+		boost::mutex::scoped_lock lock(epochMutex);
+		epoch = epochValues[gpu];
+	}
 
-	// While the mining is running print some statistics
-	while (restart) {
-		this_thread::sleep_for(std::chrono::seconds(15));
-
-		// Print performance stats (roughly)
-		cout << "Performance: ";
-		uint32_t totalSols = 0;
-		for (int i=0; i<devices.size(); i++) {
-			uint32_t sol = solutionCnt[i];
-			solutionCnt[i] = 0;
-			totalSols += sol;
-			cout << fixed << setprecision(2) << (double) sol / 15.0 << " sol/s ";
-			
+	if (err == CL_SUCCESS) queue = cl::CommandQueue(context, devices[gpu], queue_prop, &err);
+	if (err == CL_SUCCESS) epochQueue = cl::CommandQueue(context, devices[gpu], 0, &err);
+	if (err == CL_SUCCESS) epochBuffer = cl::Buffer(context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(cl_uint), &epoch, &err);
+
+	if (err == CL_SUCCESS) err = HdsHashI.rebuild(context, devices[gpu], gpu, epochBuffer);
+	if (err == CL_SUCCESS) err = HdsHashII.rebuild(context, devices[gpu], gpu, epochBuffer);
+	if (err == CL_SUCCESS) err = HdsHashIII.rebuild(context, devices[gpu], gpu, epochBuffer);
+
+	// Tried again on the next check, where it counts as another failure
+	if (err != CL_SUCCESS) {
+		HDS_LOG(logError) << "Device " << deviceIds[gpu] << ": reset failed (OpenCL error " << err << ")";
+		return;
+	}
+
+	// Jobs that arrived during the rebuild only reached the old flag, the lock keeps further ones out during the swap
+	{
+		boost::mutex::scoped_lock lock(epochMutex);
+		if (epochValues[gpu] != epoch) {
+			epochQueue.enqueueWriteBuffer(epochBuffer, CL_FALSE, 0, sizeof(cl_uint), &epochValues[gpu]);
+			epochQueue.flush();
 		}
 
-		if (devices.size() > 1) cout << "| Total: " << setprecision(2) << (double) totalSols / 15.0 << " sol/s ";
-		cout << endl;
+		retiredQueues.push_back(queues[gpu]);
+		retiredQueues.push_back(epochQueues[gpu]);
+		retiredBuffers.push_back(epochBuffers[gpu]);
+		epochQueues[gpu] = epochQueue;
+		epochBuffers[gpu] = epochBuffer;
+	}
 
-		
+	deviceContexts[gpu] = context;
+	queues[gpu] = queue;
+	events[gpu] = cl::Event();
 
-		// Check if there are paused devices and restart them
-		for (int i=0; i<devices.size(); i++) {
-			if (paused[i] && stratum->hasWork()) {
-				paused[i] = false;
-				
-				// Same as above
-				solverType nextSolver;
-				stratum->getWork(currentWork[i].wd, &nextSolver);
-
-				hdsSolver * activeSolver;
-				switch (nextSolver) {
-					case HdsI:
-						activeSolver = &HdsHashI;
-						break;
-
-					case HdsII:
-						activeSolver = &HdsHashII;
-						break;
-
-					case HdsIII:
-						activeSolver = &HdsHashIII;
-						break;
-
-					case None: 
-						paused[i] = true;
-						break;
-				}
+	uint32_t recoveries = ++h.recoveries;
+	HDS_LOG(logWarning) << "Device " << deviceIds[gpu] << ": reset after " << h.reason.load() << ", recovery " << recoveries;
 
-				currentWork[i].currentSolver = nextSolver;
+	// The rebuild dropped all buffers, a prepared solver is prepared again with the next launch
+	staging[gpu] = solverStaging();
 
-				activeSolver->createBuffers(contexts[deviceContext[i]], devices[i], i);
-				activeSolver->queueKernels(&queues[i], i, &events[i], &currentWork[i]);
-				events[i].setCallback(CL_COMPLETE, &CCallbackFunc, (void*) &currentWork[i]);
-				queues[i].flush();
-			}
+	h.iterationMs = 0;
+	h.failed = false;
+	if (mining) resumeDevice(gpu);
+}
 
-		} 
-	} 
+
+vector<deviceStatus> clHost::getStatus() {
+	boost::mutex::scoped_lock lock(statusMutex);
+	vector<deviceStatus> result = status;
+	for (uint32_t i=0; i<result.size(); i++) {
+		deviceHealth &h = health[i];
+		result[i].userPaused = userPaused[i];
+		result[i].idle = paused[i] && !userPaused[i] && !h.failed;
+		result[i].failed = h.failed;
+		result[i].quarantined = h.quarantined;
+		result[i].recoveries = h.recoveries;
+		result[i].lastError = h.lastError;
+	}
+	return result;
+}
+
+
+// Pauses or resumes the device with the given system number. A paused device finishes its running launch.
+// Resuming a quarantined device lets the watchdog reset it right away.
+bool clHost::pauseDevice(uint32_t id, bool pause) {
+	for (uint32_t i=0; i<devices.size(); i++) {
+		if (deviceIds[i] != id) continue;
+
+		userPaused[i] = pause;
+		HDS_LOG(logInfo) << "Device " << id << (pause ? " paused" : " resumed") << " by the API";
+		if (!pause && health[i].quarantined.exchange(false)) HDS_LOG(logInfo) << "Device " << id << " released from quarantine";
+		if (!pause && mining) resumeDevice(i);
+		return true;
+	}
+	return false;
+}
+
+
+// Iterations per launch, limited by the buffers allocated at the start
+bool clHost::setBatchSize(uint32_t size) {
+	if ((size < 1) || (size > config.batchSize)) return false;
+	launchBatch = size;
+	HDS_LOG(logInfo) << "Batch size set to " << size << " by the API";
+	return true;
 }
 
 
@@ -12,15 +12,80 @@
 #include <map>
 #include <cstdlib>
 #include <climits>
+#include <deque>
+#include <atomic>
+#include <algorithm>
 
 #include "hdsSolvers.h"
 #include "hdsStratum.h"
+#include "deviceStats.h"
 
 #ifndef hdsMiner_H
 #define hdsMiner_H
 
 namespace hdsMiner {
 
+// Options for the OpenCL host set from the command line
+struct clHostConfig {
+	bool devicePrePow = false;	// HdsHash III: derive the prePow on the GPU instead of the CPU
+	uint32_t batchSize = 1;		// HdsHash III: iterations enqueued per launch, > 1 implies devicePrePow
+	bool allowCPU = false;		// Also mine on CPU OpenCL devices, for tests without a GPU
+	bool debug = false;
+};
+
+// Statistics of one device over the last statistics interval, for the API
+struct deviceStatus {
+	uint32_t id = 0;		// Number of the device in the system
+	uint32_t group = 0;
+	string name;
+	bool userPaused = false;
+	bool idle = false;		// Waiting for work
+	double solPerSec = 0;		// Over the last statistics interval
+	deviceRates rates;		// Smoothed and windowed
+	double iterationMs = 0;		// Wall time per solver iteration
+	double hostUsPerIteration = 0;
+	double switchMs = 0;		// Job to first kernel, average
+	uint64_t solutions = 0;		// Since the start
+	uint64_t iterations = 0;
+	bool failed = false;		// Stopped until the watchdog reset it
+	bool quarantined = false;	// Failed too often, left alone for a while
+	uint32_t recoveries = 0;
+	int32_t lastError = 0;		// OpenCL status of the last failure, 0 for an overdue launch
+};
+
+// Watchdog state of one device
+struct deviceHealth {
+	std::atomic<cl_event> launch {nullptr};	// Completes the running launch, taken by whoever ends it
+	std::atomic<int64_t> launchStartUs {0};
+	std::atomic<uint32_t> launchIterations {1};
+	std::atomic<double> iterationMs {0};		// Average of the finished launches
+	std::atomic<bool> failed {false};
+	std::atomic<bool> quarantined {false};
+	std::atomic<uint32_t> recoveries {0};
+	std::atomic<int32_t> lastError {CL_SUCCESS};
+	std::atomic<const char*> reason {""};
+
+	// Only used by the watchdog
+	deque<std::chrono::steady_clock::time_point> failures;
+	std::chrono::steady_clock::time_point quarantineEnd;
+};
+
+// Solver of a coming fork, prepared next to the running one. Only used by the launch sequence of its device.
+struct solverStaging {
+	solverType solver = None;
+	bool cold = false;		// Could not be prepared, the switch allocates the buffers
+	bool warmupPending = false;	// The results of the warm-up launch are still mapped
+	cl::Event warmup;
+	clCallbackData work;		// Work of the warm-up launch, its solutions are dropped
+
+	// Measurement of the switch at the fork
+	bool warmupLaunch = false;	// The running launch waited for the warm-up, its time is no expectation
+	int64_t launchEndUs = 0;	// The last launch of any solver completed
+	bool switchLaunch = false;	// The running launch is the first one after the switch
+	bool switchPrepared = false;
+	solverType switchedFrom = None;
+	double switchGapMs = 0;
+};
 
 class clHost {
 	private:
@@ -28,15 +93,48 @@ class clHost {
 	vector<cl::Platform> platforms;  
 	vector<cl::Context> contexts;
 	vector<cl::Device> devices;
+	vector<cl::Context> deviceContexts;	// The platform context, or an own one after a reset
+	vector<uint32_t> deviceIds;		// Number of the device in the system, as used by --devices
+	vector<string> deviceNames;
 	vector<cl::Event> events;
 	vector<cl::CommandQueue> queues;
-	vector< uint32_t > deviceContext;
+
+	// Oldest job epoch the kernels still run for, written through a second queue on every new job. Whether
+	// a running kernel sees the write is up to the driver, so cancellation is best-effort: late solutions
+	// are judged by the stratum either way.
+	vector<cl::Buffer> epochBuffers;
+	vector<cl::CommandQueue> epochQueues;
+	deque<uint32_t> epochValues;		// Host copy, the source of the writes
+	boost::mutex epochMutex;
+	void onNewJob(uint32_t, uint64_t);
+
+	// Watchdog, resets devices whose launch failed or is overdue
+	deque<deviceHealth> health;
+	vector<cl::CommandQueue> retiredQueues;
+	vector<cl::Buffer> retiredBuffers;
+	void deviceFailed(uint32_t, const char*, cl_int);
+	void checkDevices();
+	void recoverDevice(uint32_t);
+
+	// Pre-staging of the solver that takes over at the next fork height
+	vector<solverStaging> staging;
+	static constexpr uint64_t stagingHeadroomPercent = 10;	// Of the device memory, left to the driver and the display
+	bool prestageSolver(uint32_t);
+	void finishWarmup(uint32_t);
 
 	// Statistics
-	vector<int> solutionCnt;
+	deviceStats stats;
+	void onShareResult(uint32_t, uint32_t, double, bool);
 
 	// To check if a mining thread stoped and we must resume it
-	vector<bool> paused;
+	deque< std::atomic<bool> > paused;
+	deque< std::atomic<bool> > userPaused;
+	std::atomic<uint32_t> launchBatch {1};
+	std::atomic<bool> mining {false};
+
+	// Results of the last statistics interval, read by the API
+	vector<deviceStatus> status;
+	boost::mutex statusMutex;
 
 	// Callback data
 	vector<clCallbackData> currentWork;
@@ -44,19 +142,36 @@ class clHost {
 
 	// Functions
 	void detectPlatFormDevices(vector<int32_t>, bool);
+	hdsSolver * getSolver(solverType);
+	void startDevice(uint32_t);
+	void resumeDevice(uint32_t);
+
+	// Timeline trace, the host time each launch was enqueued
+	vector<int64_t> launchTraceUs;
+	void traceKernels(uint32_t, hdsSolver*);
 	
-	// The connector
-	hdsStratum* stratum;
+	// The connectors, every device group mines for its own stratum session
+	vector<hdsStratum*> stratums;
+	vector<uint32_t> deviceGroup;
+	hdsStratum* stratumOf(uint32_t gpu) { return stratums[deviceGroup[gpu]]; }
+	clHostConfig config;
 
-	hdsHashI_S   HdsHashI;
-	hdsHashII_S  HdsHashII;
-	hdsHashIII_S HdsHashIII;
+	hdsSolver HdsHashI {hdsHashISpec()};
+	hdsSolver HdsHashII {hdsHashIISpec()};
+	hdsSolver HdsHashIII {hdsHashIIISpec()};
 
 	public:
 	
-	void setup(hdsStratum*, vector<int32_t>);
+	void setup(vector<hdsStratum*>, vector< vector<int32_t> >, clHostConfig);
 	void startMining();	
 	void callbackFunc(cl_int, void*);
+	bool endLaunch(uint32_t, cl_event);
+
+	// Used by the API, safe to call from any thread
+	vector<deviceStatus> getStatus();
+	bool pauseDevice(uint32_t, bool);
+	bool setBatchSize(uint32_t);
+	uint32_t maxBatchSize() { return config.batchSize; }
 };
 
 }
@@ -0,0 +1,150 @@
+// HDS OpenCL Miner
+// Device statistics
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "deviceStats.h"
+
+namespace hdsMiner {
+
+void deviceStats::setup(uint32_t devices) {
+	deviceCount = devices;
+	counters.reset(new deviceCounters[devices]);
+	last.assign(devices, deviceInterval());
+	rates.assign(devices, deviceRates());
+	history.clear();
+
+	sample start;
+	start.time = std::chrono::steady_clock::now();
+	start.solutions.assign(devices, 0);
+	start.accepted.assign(devices, 0);
+	start.work.assign(devices, 0.0);
+	start.work2.assign(devices, 0.0);
+	history.push_back(start);
+}
+
+
+void deviceStats::addShare(uint32_t dev, double difficulty, bool accepted) {
+	if (dev >= deviceCount) return;
+	deviceCounters &c = counters[dev];
+
+	if (!accepted) {
+		c.rejected.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	// One writer per device, so load and store are enough for the sums
+	c.acceptedWork.store(c.acceptedWork.load(std::memory_order_relaxed) + difficulty, std::memory_order_relaxed);
+	c.acceptedWork2.store(c.acceptedWork2.load(std::memory_order_relaxed) + difficulty * difficulty, std::memory_order_relaxed);
+	c.accepted.fetch_add(1, std::memory_order_release);
+}
+
+
+// Poisson count n in t seconds. The interval uses the square root approximation of the
+// exact chi square bounds, which also holds for few events: ((sqrt(n) - z/2)^2, (sqrt(n+1) + z/2)^2)
+rateEstimate deviceStats::poissonRate(double n, double t) {
+	rateEstimate r;
+	if (t <= 0) return r;
+
+	const double halfZ = 0.98;
+	double low = (n > 0) ? std::max(0.0, sqrt(n) - halfZ) : 0.0;
+	double high = sqrt(n + 1.0) + halfZ;
+
+	r.rate = n / t;
+	r.low = low * low / t;
+	r.high = high * high / t;
+	return r;
+}
+
+
+// Shares of varying difficulty: the sum of their difficulties behaves like a Poisson count of
+// work^2 / work2 events, each worth work2 / work
+rateEstimate deviceStats::workRate(double work, double work2, double t) {
+	rateEstimate r;
+	if ((t <= 0) || (work2 <= 0)) return r;
+
+	double scale = work2 / work;
+	rateEstimate events = poissonRate(work / scale, t);
+	r.rate = work / t;
+	r.low = events.low * scale;
+	r.high = events.high * scale;
+	return r;
+}
+
+
+std::vector<deviceInterval> deviceStats::takeSample() {
+	sample now;
+	now.time = std::chrono::steady_clock::now();
+	now.solutions.resize(deviceCount);
+	now.accepted.resize(deviceCount);
+	now.work.resize(deviceCount);
+	now.work2.resize(deviceCount);
+
+	std::vector<deviceInterval> result(deviceCount);
+	double seconds = std::chrono::duration<double>(now.time - history.back().time).count();
+
+	for (uint32_t i=0; i<deviceCount; i++) {
+		deviceCounters &c = counters[i];
+
+		// The count of accepted shares is written last, so the sums include all of them
+		now.accepted[i] = c.accepted.load(std::memory_order_acquire);
+		now.work[i] = c.acceptedWork.load(std::memory_order_relaxed);
+		now.work2[i] = c.acceptedWork2.load(std::memory_order_relaxed);
+		now.solutions[i] = c.solutions.load(std::memory_order_relaxed);
+
+		deviceInterval total;
+		total.solutions = now.solutions[i];
+		total.iterations = c.iterations.load(std::memory_order_relaxed);
+		total.skipped = c.skipped.load(std::memory_order_relaxed);
+		total.hostTimeUs = c.hostTimeUs.load(std::memory_order_relaxed);
+		total.switches = c.switches.load(std::memory_order_relaxed);
+		total.switchTimeUs = c.switchTimeUs.load(std::memory_order_relaxed);
+
+		result[i].seconds = seconds;
+		result[i].solutions = total.solutions - last[i].solutions;
+		result[i].iterations = total.iterations - last[i].iterations;
+		result[i].skipped = total.skipped - last[i].skipped;
+		result[i].hostTimeUs = total.hostTimeUs - last[i].hostTimeUs;
+		result[i].switches = total.switches - last[i].switches;
+		result[i].switchTimeUs = total.switchTimeUs - last[i].switchTimeUs;
+		result[i].switchMaxUs = c.switchMaxUs.exchange(0, std::memory_order_relaxed);
+		last[i] = total;
+	}
+
+	history.push_back(now);
+	while ((history.size() > 2) && (now.time - history[1].time >= std::chrono::seconds(statWindowSec[statWindows-1]))) history.pop_front();
+
+	boost::mutex::scoped_lock lock(ratesMutex);
+	for (uint32_t i=0; i<deviceCount; i++) {
+		deviceRates &r = rates[i];
+
+		if (seconds > 0) {
+			double alpha = 1.0 - exp(-seconds / 60.0);
+			double current = (double) result[i].solutions / seconds;
+			r.ewma = (history.size() == 2) ? current : r.ewma + alpha * (current - r.ewma);
+		}
+
+		// Each window starts at the oldest sample inside it, short runs use what they have
+		for (uint32_t w=0; w<statWindows; w++) {
+			auto start = history.begin();
+			while ((start + 2 != history.end()) && (now.time - start->time > std::chrono::seconds(statWindowSec[w]))) start++;
+
+			double t = std::chrono::duration<double>(now.time - start->time).count();
+			r.solutions[w] = poissonRate((double) (now.solutions[i] - start->solutions[i]), t);
+			r.effective[w] = workRate(now.work[i] - start->work[i], now.work2[i] - start->work2[i], t);
+		}
+
+		r.accepted = now.accepted[i];
+		r.rejected = counters[i].rejected.load(std::memory_order_relaxed);
+	}
+
+	return result;
+}
+
+
+deviceRates deviceStats::getRates(uint32_t dev) {
+	boost::mutex::scoped_lock lock(ratesMutex);
+	return (dev < rates.size()) ? rates[dev] : deviceRates();
+}
+
+}
@@ -0,0 +1,103 @@
+// HDS OpenCL Miner
+// Device statistics
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#ifndef deviceStats_H
+#define deviceStats_H
+
+namespace hdsMiner {
+
+// Counters of one device. The callback thread of the device and the stratum thread of its group
+// write them, the statistics thread reads them. They only grow, except switchMaxUs.
+struct alignas(64) deviceCounters {
+	std::atomic<uint64_t> solutions{0};
+	std::atomic<uint64_t> iterations{0};
+	std::atomic<uint64_t> skipped{0};		// Iterations dropped for a new job
+	std::atomic<uint64_t> hostTimeUs{0};
+	std::atomic<uint64_t> switches{0};
+	std::atomic<uint64_t> switchTimeUs{0};
+	std::atomic<uint64_t> switchMaxUs{0};
+	std::atomic<uint64_t> accepted{0};
+	std::atomic<uint64_t> rejected{0};
+	std::atomic<double> acceptedWork{0};		// Sum of the difficulties of accepted shares
+	std::atomic<double> acceptedWork2{0};		// Sum of their squares, for the variance
+};
+
+// A rate per second with its 95% confidence interval
+struct rateEstimate {
+	double rate = 0;
+	double low = 0;
+	double high = 0;
+};
+
+static const uint32_t statWindows = 3;
+static const uint32_t statWindowSec[statWindows] = {60, 900, 3600};
+
+// Rates of one device. Solutions come straight from the GPU, the effective rate is the
+// difficulty of the accepted shares per second and shows what the pool credits.
+struct deviceRates {
+	double ewma = 0;			// Solutions per second, one minute time constant
+	rateEstimate solutions[statWindows];
+	rateEstimate effective[statWindows];
+	uint64_t accepted = 0;
+	uint64_t rejected = 0;
+};
+
+// Counter changes since the previous sample
+struct deviceInterval {
+	double seconds = 0;
+	uint64_t solutions = 0;
+	uint64_t iterations = 0;
+	uint64_t skipped = 0;
+	uint64_t hostTimeUs = 0;
+	uint64_t switches = 0;
+	uint64_t switchTimeUs = 0;
+	uint64_t switchMaxUs = 0;
+};
+
+class deviceStats {
+	private:
+	struct sample {
+		std::chrono::steady_clock::time_point time;
+		std::vector<uint64_t> solutions;
+		std::vector<uint64_t> accepted;
+		std::vector<double> work;
+		std::vector<double> work2;
+	};
+
+	uint32_t deviceCount = 0;
+	std::unique_ptr<deviceCounters[]> counters;
+	std::deque<sample> history;			// One sample per call of takeSample, one hour back
+	std::vector<deviceInterval> last;		// Counters at the previous sample, as absolute values
+	std::vector<deviceRates> rates;
+	boost::mutex ratesMutex;
+
+	public:
+	void setup(uint32_t);
+	deviceCounters& device(uint32_t dev) { return counters[dev]; }
+
+	// Only called from the stratum thread of the group of the device
+	void addShare(uint32_t, double, bool);
+
+	// Called from the statistics thread, returns what changed since the last call
+	std::vector<deviceInterval> takeSample();
+
+	deviceRates getRates(uint32_t);
+
+	static rateEstimate poissonRate(double, double);
+	static rateEstimate workRate(double, double, double);
+};
+
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "blake2b.h"
+#include "blake2b_x86.h"
 
 void blake2bInstance::init(uint8_t hash_len, uint32_t n, uint32_t k, std::string personal) {
 	h[0] = blake2b_iv[0] ^ (0x01010000 | hash_len);
@@ -81,3 +82,58 @@ blake2bInstance::blake2bInstance() {
 	bytes = 0;
 	for (int i=0; i<8; i++) h[i] = 0;
 }
+
+
+namespace {
+	enum blake2bImpl { implPortable, implAvx2, implAvx512 };
+
+	blake2bImpl detectImpl() {
+#ifdef BLAKE2B_X86
+		if (blake2bHasAvx512()) return implAvx512;
+		if (blake2bHasAvx2()) return implAvx2;
+#endif
+		return implPortable;
+	}
+
+	blake2bImpl getImpl() {
+		static const blake2bImpl impl = detectImpl();
+		return impl;
+	}
+}
+
+const char* blake2bImplementation() {
+	switch (getImpl()) {
+		case implAvx512: return "AVX-512";
+		case implAvx2: return "AVX2";
+		default: return "portable";
+	}
+}
+
+void blake2bEquihashBatch(const uint8_t *msg, size_t stride, size_t count, uint8_t hashLen, uint32_t n, uint32_t k, uint8_t *out) {
+	blake2bInstance param;
+	param.init(hashLen, n, k, "Hds--PoW");
+
+	size_t i = 0;
+#ifdef BLAKE2B_X86
+	uint64_t h[8];
+	param.ret_state(h);
+	blake2bImpl impl = getImpl();
+
+	// A CPU with AVX-512 also takes the AVX2 path for a rest of 4 to 7 messages
+	if (impl == implAvx512) {
+		for (; i + 8 <= count; i += 8) blake2bEquihash8_Avx512(h, msg + i*stride, stride, hashLen, out + i*hashLen);
+	}
+	if (impl != implPortable) {
+		for (; i + 4 <= count; i += 4) blake2bEquihash4_Avx2(h, msg + i*stride, stride, hashLen, out + i*hashLen);
+	}
+#endif
+
+	for (; i < count; i++) {
+		uint8_t block[blake2b_block_len] = {0};
+		memcpy(block, msg + i*stride, 44);
+
+		blake2bInstance inst(param);
+		inst.update(block, 44, 1);
+		inst.ret_final(out + i*hashLen, hashLen);
+	}
+}
@@ -1,3 +1,6 @@
+#ifndef BLAKE2B_H
+#define BLAKE2B_H
+
 #include <stdint.h>
 #include <string>
 #include <cstring>
@@ -16,6 +19,12 @@ class blake2bInstance {
 		blake2bInstance (const blake2bInstance &inp);
 };
 
+// Hashes count Equihash inputs of 44 bytes (32 byte work, 8 byte nonce, 4 byte index) with the
+// personalization "Hds--PoW" and the parameters n and k. Message i starts at msg + i*stride, its hash
+// of hashLen bytes goes to out + i*hashLen. Groups of 8 or 4 messages use AVX-512 or AVX2 if the CPU has it.
+void blake2bEquihashBatch(const uint8_t *msg, size_t stride, size_t count, uint8_t hashLen, uint32_t n, uint32_t k, uint8_t *out);
+const char* blake2bImplementation();
+
 
 static const uint32_t   blake2b_block_len = 128;
 static const uint32_t   blake2b_rounds = 12;
@@ -39,3 +48,5 @@ static const uint8_t    blake2b_sigma[12][16] = {
       { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
       {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
       { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }};
+
+#endif
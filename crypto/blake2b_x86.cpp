@@ -0,0 +1,200 @@
+// Blake2b with AVX2 and AVX-512 for several messages at once
+//
+// Every vector lane holds the same state word of a different message, so the G function works on
+// 4 or 8 messages like the scalar one on a single message. The functions carry their instruction
+// set as target attribute, blake2b.cpp only calls them after the CPU check passed.
+
+#include <cstring>
+#include "blake2b.h"
+#include "blake2b_x86.h"
+
+#ifdef BLAKE2B_X86
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define BLAKE2B_TARGET(x)
+#else
+#include <cpuid.h>
+#define BLAKE2B_TARGET(x) __attribute__((target(x)))
+#endif
+
+namespace {
+
+	const uint32_t equihashMsgLen = 44;
+
+	void cpuid(uint32_t leaf, uint32_t sub, uint32_t *r) {
+#ifdef _MSC_VER
+		int regs[4];
+		__cpuidex(regs, (int) leaf, (int) sub);
+		for (int i=0; i<4; i++) r[i] = (uint32_t) regs[i];
+#else
+		r[0] = r[1] = r[2] = r[3] = 0;
+		if (leaf <= __get_cpuid_max(0, 0)) __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+#endif
+	}
+
+	// Register state the operating system saves on a context switch
+	uint64_t enabledState() {
+		uint32_t r1[4];
+		cpuid(1, 0, r1);
+		if (!((r1[2] >> 27) & 1)) return 0;	// OSXSAVE
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		uint32_t lo, hi;
+		__asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		return (((uint64_t) hi) << 32) | lo;
+#endif
+	}
+
+	// Message words of each lane, word j of lane l at words[j*lanes + l]. Only the first 6 words of
+	// the 44 byte messages are not zero.
+	void loadWords(const uint8_t *msg, size_t stride, uint32_t lanes, uint64_t *words) {
+		for (uint32_t l=0; l<lanes; l++) {
+			uint64_t m[6] = {0};
+			memcpy(m, msg + l*stride, equihashMsgLen);
+			for (uint32_t j=0; j<6; j++) words[j*lanes + l] = m[j];
+		}
+	}
+
+	// The inverse for the result, word j of lane l goes to the hash of message l
+	void storeHashes(const uint64_t *words, uint32_t lanes, uint32_t hashLen, uint8_t *out) {
+		for (uint32_t l=0; l<lanes; l++) {
+			uint64_t h[8];
+			for (uint32_t j=0; j<8; j++) h[j] = words[j*lanes + l];
+			memcpy(out + l*hashLen, h, hashLen);
+		}
+	}
+}
+
+// One round on the vectors v[16] with the message vectors m[16], the vector operations
+// ADD, XOR and ROTR_32/24/16/63 are defined in front of each function
+#define BLAKE2B_G(a, b, c, d, x, y) \
+	a = ADD(ADD(a, b), x); \
+	d = ROTR_32(XOR(d, a)); \
+	c = ADD(c, d); \
+	b = ROTR_24(XOR(b, c)); \
+	a = ADD(ADD(a, b), y); \
+	d = ROTR_16(XOR(d, a)); \
+	c = ADD(c, d); \
+	b = ROTR_63(XOR(b, c));
+
+#define BLAKE2B_ROUND(s) \
+	BLAKE2B_G(v[0], v[4], v[8],  v[12], m[s[0]],  m[s[1]]); \
+	BLAKE2B_G(v[1], v[5], v[9],  v[13], m[s[2]],  m[s[3]]); \
+	BLAKE2B_G(v[2], v[6], v[10], v[14], m[s[4]],  m[s[5]]); \
+	BLAKE2B_G(v[3], v[7], v[11], v[15], m[s[6]],  m[s[7]]); \
+	BLAKE2B_G(v[0], v[5], v[10], v[15], m[s[8]],  m[s[9]]); \
+	BLAKE2B_G(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]); \
+	BLAKE2B_G(v[2], v[7], v[8],  v[13], m[s[12]], m[s[13]]); \
+	BLAKE2B_G(v[3], v[4], v[9],  v[14], m[s[14]], m[s[15]]);
+
+bool blake2bHasAvx2() {
+	uint32_t r7[4];
+	cpuid(7, 0, r7);
+	return ((enabledState() & 0x06) == 0x06) && ((r7[1] >> 5) & 1);
+}
+
+bool blake2bHasAvx512() {
+	uint32_t r7[4];
+	cpuid(7, 0, r7);
+	// AVX512F, and the OS must save the opmask and both halves of the zmm registers
+	return ((enabledState() & 0xE6) == 0xE6) && ((r7[1] >> 16) & 1);
+}
+
+
+#define ADD(a, b) _mm256_add_epi64(a, b)
+#define XOR(a, b) _mm256_xor_si256(a, b)
+#define ROTR_32(x) _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR_24(x) _mm256_shuffle_epi8(x, rot24)
+#define ROTR_16(x) _mm256_shuffle_epi8(x, rot16)
+#define ROTR_63(x) _mm256_or_si256(_mm256_srli_epi64(x, 63), _mm256_add_epi64(x, x))
+
+BLAKE2B_TARGET("avx2")
+void blake2bEquihash4_Avx2(const uint64_t *h, const uint8_t *msg, size_t stride, uint32_t hashLen, uint8_t *out) {
+	const __m256i rot24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+					       3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+	const __m256i rot16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+					       2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+	uint64_t words[8*4];
+	loadWords(msg, stride, 4, words);
+
+	__m256i m[16];
+	for (uint32_t j=0; j<6; j++) m[j] = _mm256_loadu_si256((const __m256i *) &words[j*4]);
+	for (uint32_t j=6; j<16; j++) m[j] = _mm256_setzero_si256();
+
+	__m256i v[16];
+	for (uint32_t i=0; i<8; i++) {
+		v[i] = _mm256_set1_epi64x((int64_t) h[i]);
+		v[i + 8] = _mm256_set1_epi64x((int64_t) blake2b_iv[i]);
+	}
+	v[12] = XOR(v[12], _mm256_set1_epi64x(equihashMsgLen));
+	v[14] = XOR(v[14], _mm256_set1_epi64x(-1));
+
+	for (uint32_t round = 0; round < blake2b_rounds; round++) {
+		const uint8_t *s = blake2b_sigma[round];
+		BLAKE2B_ROUND(s)
+	}
+
+	for (uint32_t i=0; i<8; i++) {
+		__m256i r = XOR(_mm256_set1_epi64x((int64_t) h[i]), XOR(v[i], v[i + 8]));
+		_mm256_storeu_si256((__m256i *) &words[i*4], r);
+	}
+	storeHashes(words, 4, hashLen, out);
+}
+
+#undef ADD
+#undef XOR
+#undef ROTR_32
+#undef ROTR_24
+#undef ROTR_16
+#undef ROTR_63
+
+
+#define ADD(a, b) _mm512_add_epi64(a, b)
+#define XOR(a, b) _mm512_xor_si512(a, b)
+#define ROTR_32(x) _mm512_ror_epi64(x, 32)
+#define ROTR_24(x) _mm512_ror_epi64(x, 24)
+#define ROTR_16(x) _mm512_ror_epi64(x, 16)
+#define ROTR_63(x) _mm512_ror_epi64(x, 63)
+
+BLAKE2B_TARGET("avx512f")
+void blake2bEquihash8_Avx512(const uint64_t *h, const uint8_t *msg, size_t stride, uint32_t hashLen, uint8_t *out) {
+	uint64_t words[8*8];
+	loadWords(msg, stride, 8, words);
+
+	__m512i m[16];
+	for (uint32_t j=0; j<6; j++) m[j] = _mm512_loadu_si512((const void *) &words[j*8]);
+	for (uint32_t j=6; j<16; j++) m[j] = _mm512_setzero_si512();
+
+	__m512i v[16];
+	for (uint32_t i=0; i<8; i++) {
+		v[i] = _mm512_set1_epi64((int64_t) h[i]);
+		v[i + 8] = _mm512_set1_epi64((int64_t) blake2b_iv[i]);
+	}
+	v[12] = XOR(v[12], _mm512_set1_epi64(equihashMsgLen));
+	v[14] = XOR(v[14], _mm512_set1_epi64(-1));
+
+	for (uint32_t round = 0; round < blake2b_rounds; round++) {
+		const uint8_t *s = blake2b_sigma[round];
+		BLAKE2B_ROUND(s)
+	}
+
+	for (uint32_t i=0; i<8; i++) {
+		__m512i r = XOR(_mm512_set1_epi64((int64_t) h[i]), XOR(v[i], v[i + 8]));
+		_mm512_storeu_si512((void *) &words[i*8], r);
+	}
+	storeHashes(words, 8, hashLen, out);
+}
+
+#undef ADD
+#undef XOR
+#undef ROTR_32
+#undef ROTR_24
+#undef ROTR_16
+#undef ROTR_63
+
+#endif
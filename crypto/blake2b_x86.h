@@ -0,0 +1,26 @@
+// Blake2b compression of several Equihash inputs at once with AVX2 and AVX-512, used by blake2b.cpp
+
+#ifndef BLAKE2B_X86_H
+#define BLAKE2B_X86_H
+
+#include <stdint.h>
+#include <cstddef>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BLAKE2B_X86
+#endif
+
+#ifdef BLAKE2B_X86
+
+// CPU and operating system support
+bool blake2bHasAvx2();
+bool blake2bHasAvx512();
+
+// Hashes 4 or 8 of the 44 byte messages at msg + i*stride, one per lane. All lanes start from the
+// parameter block state h, hash i is written to out + i*hashLen.
+void blake2bEquihash4_Avx2(const uint64_t *h, const uint8_t *msg, size_t stride, uint32_t hashLen, uint8_t *out);
+void blake2bEquihash8_Avx512(const uint64_t *h, const uint8_t *msg, size_t stride, uint32_t hashLen, uint8_t *out);
+
+#endif
+
+#endif
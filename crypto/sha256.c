@@ -6,6 +6,7 @@ This code is based on public domain code from Wei Dai's Crypto++ library. */
 #include <stdint.h>
 #include <string.h>
 #include "sha256.h"
+#include "sha256_x86.h"
 
 /* define it for speed optimization */
 /* #define _SHA256_UNROLL */
@@ -14,7 +15,7 @@ This code is based on public domain code from Wei Dai's Crypto++ library. */
 #define rotlFixed(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
 #define rotrFixed(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
 
-inline void Sha256_Init(CSha256 *p)
+void Sha256_Init(CSha256 *p)
 {
   p->state[0] = 0x6a09e667;
   p->state[1] = 0xbb67ae85;
@@ -76,7 +77,7 @@ inline void Sha256_Init(CSha256 *p)
 
 #endif
 
-static const uint32_t K[64] = {
+const uint32_t Sha256_K[64] = {
   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
   0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
   0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
@@ -95,6 +96,8 @@ static const uint32_t K[64] = {
   0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
 };
 
+#define K Sha256_K
+
 inline static void Sha256_Transform(uint32_t *state, const uint32_t *data)
 {
   uint32_t W[16];
@@ -149,23 +152,77 @@ inline static void Sha256_Transform(uint32_t *state, const uint32_t *data)
 #undef s0
 #undef s1
 
-inline static void Sha256_WriteByteBlock(CSha256 *p)
+void Sha256_Blocks_Portable(uint32_t *state, const uint8_t *data, size_t blocks)
 {
   uint32_t data32[16];
   unsigned i;
-  for (i = 0; i < 16; i++)
-    data32[i] =
-      ((uint32_t)(p->buffer[i * 4    ]) << 24) +
-      ((uint32_t)(p->buffer[i * 4 + 1]) << 16) +
-      ((uint32_t)(p->buffer[i * 4 + 2]) <<  8) +
-      ((uint32_t)(p->buffer[i * 4 + 3]));
-  Sha256_Transform(p->state, data32);
+  for (; blocks > 0; blocks--, data += 64)
+  {
+    for (i = 0; i < 16; i++)
+      data32[i] =
+        ((uint32_t)(data[i * 4    ]) << 24) +
+        ((uint32_t)(data[i * 4 + 1]) << 16) +
+        ((uint32_t)(data[i * 4 + 2]) <<  8) +
+        ((uint32_t)(data[i * 4 + 3]));
+    Sha256_Transform(state, data32);
+  }
+}
+
+/* Picked once from the CPU features, a race on the first call only computes the same value twice */
+enum { SHA256_IMPL_UNKNOWN, SHA256_IMPL_PORTABLE, SHA256_IMPL_SHANI, SHA256_IMPL_AVX2 };
+static volatile int g_Sha256_Impl = SHA256_IMPL_UNKNOWN;
+
+static int Sha256_GetImpl(void)
+{
+  int impl = g_Sha256_Impl;
+  if (impl == SHA256_IMPL_UNKNOWN)
+  {
+    impl = SHA256_IMPL_PORTABLE;
+    #ifdef SHA256_X86
+    if (Sha256_HasShaNi())
+      impl = SHA256_IMPL_SHANI;
+    else if (Sha256_HasAvx2())
+      impl = SHA256_IMPL_AVX2;
+    #endif
+    g_Sha256_Impl = impl;
+  }
+  return impl;
 }
 
-inline void Sha256_Update(CSha256 *p, const uint8_t *data, size_t size)
+const char *Sha256_Implementation(void)
+{
+  switch (Sha256_GetImpl())
+  {
+    case SHA256_IMPL_SHANI: return "SHA-NI";
+    case SHA256_IMPL_AVX2: return "AVX2";
+    default: return "portable";
+  }
+}
+
+static void Sha256_Blocks(uint32_t *state, const uint8_t *data, size_t blocks)
+{
+  #ifdef SHA256_X86
+  if (Sha256_GetImpl() == SHA256_IMPL_SHANI)
+  {
+    Sha256_Blocks_ShaNi(state, data, blocks);
+    return;
+  }
+  #endif
+  Sha256_Blocks_Portable(state, data, blocks);
+}
+
+static void Sha256_WriteByteBlock(CSha256 *p)
+{
+  Sha256_Blocks(p->state, p->buffer, 1);
+}
+
+void Sha256_Update(CSha256 *p, const uint8_t *data, size_t size)
 {
   uint32_t curBufferPos = (uint32_t)p->count & 0x3F;
-  while (size > 0)
+  size_t blocks;
+
+  /* Fill a started block first, whole blocks are then hashed straight from the input */
+  while ((size > 0) && ((curBufferPos != 0) || (size < 64)))
   {
     p->buffer[curBufferPos++] = *data++;
     p->count++;
@@ -176,9 +233,21 @@ inline void Sha256_Update(CSha256 *p, const uint8_t *data, size_t size)
       Sha256_WriteByteBlock(p);
     }
   }
+
+  blocks = size >> 6;
+  if (blocks > 0)
+  {
+    Sha256_Blocks(p->state, data, blocks);
+    p->count += (uint64_t)blocks << 6;
+    data += blocks << 6;
+    size &= 0x3F;
+  }
+
+  memcpy(p->buffer, data, size);
+  p->count += size;
 }
 
-inline void Sha256_Final(CSha256 *p, uint8_t *digest)
+void Sha256_Final(CSha256 *p, uint8_t *digest)
 {
   uint64_t lenInBits = (p->count << 3);
   uint32_t curBufferPos = (uint32_t)p->count & 0x3F;
@@ -208,10 +277,27 @@ inline void Sha256_Final(CSha256 *p, uint8_t *digest)
   Sha256_Init(p);
 }
 
-inline void Sha256_Onestep(const uint8_t *data, size_t size, uint8_t *digest)
+void Sha256_Onestep(const uint8_t *data, size_t size, uint8_t *digest)
 {
     CSha256 p;
     Sha256_Init(&p);
     Sha256_Update(&p, data, size);
     Sha256_Final(&p, digest);
 }
+
+void Sha256_Many(const uint8_t *data, size_t size, size_t stride, size_t count, uint8_t *digests)
+{
+  size_t i = 0;
+
+  #ifdef SHA256_X86
+  /* SHA-NI hashes a single message faster than AVX2 hashes 8 of them per lane */
+  if (Sha256_GetImpl() == SHA256_IMPL_AVX2)
+  {
+    for (; i + 8 <= count; i += 8)
+      Sha256_Many8_Avx2(data + i * stride, size, stride, digests + i * SHA256_DIGEST_SIZE);
+  }
+  #endif
+
+  for (; i < count; i++)
+    Sha256_Onestep(data + i * stride, size, digests + i * SHA256_DIGEST_SIZE);
+}
@@ -5,8 +5,15 @@
 #ifndef __CRYPTO_SHA256_H
 #define __CRYPTO_SHA256_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #define SHA256_DIGEST_SIZE 32
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef struct
 {
   uint32_t state[8];
@@ -19,4 +26,20 @@ void Sha256_Update(CSha256 *p, const uint8_t *data, size_t size);
 void Sha256_Final(CSha256 *p, uint8_t *digest);
 void Sha256_Onestep(const uint8_t *data, size_t size, uint8_t *digest);
 
+/* Hashes count messages of the same size, message i starts at data + i * stride and its
+   digest is written to digests + i * SHA256_DIGEST_SIZE. Uses 8 lanes with AVX2 when the
+   CPU has no SHA extensions. */
+void Sha256_Many(const uint8_t *data, size_t size, size_t stride, size_t count, uint8_t *digests);
+
+/* Compresses whole 64 byte blocks with the portable code, the reference the SHA-NI and AVX2
+   paths are checked against by tools/sha256Bench */
+void Sha256_Blocks_Portable(uint32_t *state, const uint8_t *data, size_t blocks);
+
+/* Name of the implementation picked for this CPU: "SHA-NI", "AVX2" or "portable" */
+const char *Sha256_Implementation(void);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -0,0 +1,248 @@
+/* Sha256_x86.c -- SHA-256 with the SHA extensions and AVX2
+   Public domain
+
+   The functions carry their instruction set as target attribute, so the file needs no special
+   compiler flags. Sha256.c calls them only after the CPU check passed. */
+
+#include <string.h>
+#include "sha256_x86.h"
+
+#ifdef SHA256_X86
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SHA256_TARGET(x)
+#else
+#include <cpuid.h>
+#define SHA256_TARGET(x) __attribute__((target(x)))
+#endif
+
+static void Sha256_Cpuid(uint32_t leaf, uint32_t sub, uint32_t *r)
+{
+  #ifdef _MSC_VER
+  int regs[4];
+  __cpuidex(regs, (int)leaf, (int)sub);
+  r[0] = regs[0]; r[1] = regs[1]; r[2] = regs[2]; r[3] = regs[3];
+  #else
+  r[0] = r[1] = r[2] = r[3] = 0;
+  if (leaf <= __get_cpuid_max(0, 0))
+    __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+  #endif
+}
+
+int Sha256_HasShaNi(void)
+{
+  uint32_t r1[4], r7[4];
+  Sha256_Cpuid(1, 0, r1);
+  Sha256_Cpuid(7, 0, r7);
+  /* SHA (leaf 7 ebx bit 29), SSSE3 and SSE4.1 for the shuffles and blends */
+  return ((r7[1] >> 29) & 1) && ((r1[2] >> 9) & 1) && ((r1[2] >> 19) & 1);
+}
+
+int Sha256_HasAvx2(void)
+{
+  uint32_t r1[4], r7[4];
+  uint64_t xcr0;
+  Sha256_Cpuid(1, 0, r1);
+  Sha256_Cpuid(7, 0, r7);
+
+  /* The OS must save the ymm registers (OSXSAVE, then XCR0 bits 1 and 2) */
+  if (!((r1[2] >> 27) & 1) || !((r1[2] >> 28) & 1))
+    return 0;
+  #ifdef _MSC_VER
+  xcr0 = _xgetbv(0);
+  #else
+  {
+    uint32_t lo, hi;
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    xcr0 = ((uint64_t)hi << 32) | lo;
+  }
+  #endif
+  return ((xcr0 & 6) == 6) && ((r7[1] >> 5) & 1);
+}
+
+
+SHA256_TARGET("sha,sse4.1")
+void Sha256_Blocks_ShaNi(uint32_t *state, const uint8_t *data, size_t blocks)
+{
+  const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i state0, state1, msg, tmp, abefSave, cdghSave;
+  __m128i w0, w1, w2, w3;
+
+  /* The rounds work on ABEF and CDGH */
+  tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+  state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+  tmp = _mm_shuffle_epi32(tmp, 0xB1);
+  state1 = _mm_shuffle_epi32(state1, 0x1B);
+  state0 = _mm_alignr_epi8(tmp, state1, 8);
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+/* Four rounds with the message words w and round constants 4*i..4*i+3 */
+#define SHA256_NI_ROUNDS(w, i) \
+  msg = _mm_add_epi32(w, _mm_loadu_si128((const __m128i *)&Sha256_K[4 * (i)])); \
+  state1 = _mm_sha256rnds2_epu32(state1, state0, msg); \
+  msg = _mm_shuffle_epi32(msg, 0x0E); \
+  state0 = _mm_sha256rnds2_epu32(state0, state1, msg)
+
+/* Next four message words from the last sixteen: a = w[i-4], b = w[i-3], c = w[i-2], d = w[i-1] */
+#define SHA256_NI_SCHEDULE(a, b, c, d) \
+  a = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(a, b), _mm_alignr_epi8(d, c, 4)), d)
+
+  for (; blocks > 0; blocks--, data += 64)
+  {
+    unsigned i;
+    abefSave = state0;
+    cdghSave = state1;
+
+    w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), mask);
+    w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), mask);
+    w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), mask);
+    w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+
+    SHA256_NI_ROUNDS(w0, 0);
+    SHA256_NI_ROUNDS(w1, 1);
+    SHA256_NI_ROUNDS(w2, 2);
+    SHA256_NI_ROUNDS(w3, 3);
+
+    for (i = 4; i < 16; i += 4)
+    {
+      SHA256_NI_SCHEDULE(w0, w1, w2, w3);
+      SHA256_NI_ROUNDS(w0, i);
+      SHA256_NI_SCHEDULE(w1, w2, w3, w0);
+      SHA256_NI_ROUNDS(w1, i + 1);
+      SHA256_NI_SCHEDULE(w2, w3, w0, w1);
+      SHA256_NI_ROUNDS(w2, i + 2);
+      SHA256_NI_SCHEDULE(w3, w0, w1, w2);
+      SHA256_NI_ROUNDS(w3, i + 3);
+    }
+
+    state0 = _mm_add_epi32(state0, abefSave);
+    state1 = _mm_add_epi32(state1, cdghSave);
+  }
+
+#undef SHA256_NI_ROUNDS
+#undef SHA256_NI_SCHEDULE
+
+  /* Back to ABCD and EFGH */
+  tmp = _mm_shuffle_epi32(state0, 0x1B);
+  state1 = _mm_shuffle_epi32(state1, 0xB1);
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+  state1 = _mm_alignr_epi8(state1, tmp, 8);
+  _mm_storeu_si128((__m128i *)&state[0], state0);
+  _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+
+/* Block b of a message with its padding, so every lane reads whole blocks */
+static void Sha256_PaddedBlock(const uint8_t *msg, size_t size, size_t b, uint8_t *block)
+{
+  size_t start = b * 64;
+  size_t bytes = (size > start) ? size - start : 0;
+  size_t blocks = (size + 8) / 64 + 1;
+  if (bytes > 64)
+    bytes = 64;
+
+  if (bytes > 0)
+    memcpy(block, msg + start, bytes);
+  memset(block + bytes, 0, 64 - bytes);
+  if ((size >= start) && (size < start + 64))
+    block[size - start] = 0x80;
+  if (b == blocks - 1)
+  {
+    uint64_t bits = (uint64_t)size << 3;
+    unsigned i;
+    for (i = 0; i < 8; i++)
+      block[63 - i] = (uint8_t)(bits >> (8 * i));
+  }
+}
+
+#define SHA256_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+/* Message word t, computed in place from the last sixteen after the first block words */
+#define SHA256_AVX2_W(t) ((t) < 16 ? w[t] : (w[(t) & 15] = _mm256_add_epi32( \
+  _mm256_add_epi32(w[(t) & 15], _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR(w[((t) - 15) & 15], 7), \
+    SHA256_ROTR(w[((t) - 15) & 15], 18)), _mm256_srli_epi32(w[((t) - 15) & 15], 3))), \
+  _mm256_add_epi32(w[((t) - 7) & 15], _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR(w[((t) - 2) & 15], 17), \
+    SHA256_ROTR(w[((t) - 2) & 15], 19)), _mm256_srli_epi32(w[((t) - 2) & 15], 10))))))
+
+/* h += S1(e) + Ch(e,f,g) + K + W; d += h; h += S0(a) + Maj(a,b,c) */
+#define SHA256_AVX2_ROUND(a, b, c, d, e, f, g, h, t) \
+  { \
+    __m256i t1 = _mm256_add_epi32(h, _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR(e, 6), SHA256_ROTR(e, 11)), SHA256_ROTR(e, 25))); \
+    __m256i t2 = _mm256_xor_si256(_mm256_xor_si256(SHA256_ROTR(a, 2), SHA256_ROTR(a, 13)), SHA256_ROTR(a, 22)); \
+    t1 = _mm256_add_epi32(t1, _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)))); \
+    t1 = _mm256_add_epi32(t1, _mm256_add_epi32(SHA256_AVX2_W(t), _mm256_set1_epi32((int)Sha256_K[t]))); \
+    t2 = _mm256_add_epi32(t2, _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)))); \
+    d = _mm256_add_epi32(d, t1); \
+    h = _mm256_add_epi32(t1, t2); \
+  }
+
+SHA256_TARGET("avx2")
+void Sha256_Many8_Avx2(const uint8_t *data, size_t size, size_t stride, uint8_t *digests)
+{
+  static const uint32_t init[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+  const __m256i swap = _mm256_set_epi8(
+    12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+    12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+  size_t blocks = (size + 8) / 64 + 1;
+  __m256i s[8], w[16];
+  __m256i a, b, c, d, e, f, g, h;
+  uint32_t out[8][8];
+  unsigned lane, i, t;
+  size_t n;
+
+  for (i = 0; i < 8; i++)
+    s[i] = _mm256_set1_epi32((int)init[i]);
+
+  for (n = 0; n < blocks; n++)
+  {
+    /* Word t of lane l sits at padded[l][4t], loaded transposed: 8 lanes of one word per vector */
+    uint8_t padded[8][64];
+    for (lane = 0; lane < 8; lane++)
+      Sha256_PaddedBlock(data + lane * stride, size, n, padded[lane]);
+
+    for (t = 0; t < 16; t++)
+    {
+      uint32_t x[8];
+      for (lane = 0; lane < 8; lane++)
+        memcpy(&x[lane], &padded[lane][4 * t], 4);
+      w[t] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)x), swap);
+    }
+
+    a = s[0]; b = s[1]; c = s[2]; d = s[3];
+    e = s[4]; f = s[5]; g = s[6]; h = s[7];
+
+    for (t = 0; t < 64; t += 8)
+    {
+      SHA256_AVX2_ROUND(a, b, c, d, e, f, g, h, t);
+      SHA256_AVX2_ROUND(h, a, b, c, d, e, f, g, t + 1);
+      SHA256_AVX2_ROUND(g, h, a, b, c, d, e, f, t + 2);
+      SHA256_AVX2_ROUND(f, g, h, a, b, c, d, e, t + 3);
+      SHA256_AVX2_ROUND(e, f, g, h, a, b, c, d, t + 4);
+      SHA256_AVX2_ROUND(d, e, f, g, h, a, b, c, t + 5);
+      SHA256_AVX2_ROUND(c, d, e, f, g, h, a, b, t + 6);
+      SHA256_AVX2_ROUND(b, c, d, e, f, g, h, a, t + 7);
+    }
+
+    s[0] = _mm256_add_epi32(s[0], a); s[1] = _mm256_add_epi32(s[1], b);
+    s[2] = _mm256_add_epi32(s[2], c); s[3] = _mm256_add_epi32(s[3], d);
+    s[4] = _mm256_add_epi32(s[4], e); s[5] = _mm256_add_epi32(s[5], f);
+    s[6] = _mm256_add_epi32(s[6], g); s[7] = _mm256_add_epi32(s[7], h);
+  }
+
+  /* Transpose back, big endian digests */
+  for (i = 0; i < 8; i++)
+    _mm256_storeu_si256((__m256i *)out[i], _mm256_shuffle_epi8(s[i], swap));
+  for (lane = 0; lane < 8; lane++)
+    for (i = 0; i < 8; i++)
+      memcpy(digests + lane * 32 + i * 4, &out[i][lane], 4);
+}
+
+#undef SHA256_ROTR
+#undef SHA256_AVX2_W
+#undef SHA256_AVX2_ROUND
+
+#endif
@@ -0,0 +1,38 @@
+/* Sha256_x86.h -- SHA-256 with the SHA extensions and AVX2, used by Sha256.c
+   Public domain */
+
+#ifndef __CRYPTO_SHA256_X86_H
+#define __CRYPTO_SHA256_X86_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SHA256_X86
+#endif
+
+#ifdef SHA256_X86
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const uint32_t Sha256_K[64];
+
+/* CPU and operating system support */
+int Sha256_HasShaNi(void);
+int Sha256_HasAvx2(void);
+
+/* Compresses whole 64 byte blocks into the state */
+void Sha256_Blocks_ShaNi(uint32_t *state, const uint8_t *data, size_t blocks);
+
+/* 8 messages of the same size at data + i * stride, one per lane */
+void Sha256_Many8_Avx2(const uint8_t *data, size_t size, size_t stride, uint8_t *digests);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
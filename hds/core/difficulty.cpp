@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #include "difficulty.h"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace hds
 {
@@ -54,6 +56,43 @@ namespace hds
 		return memis0(a.m_pData, Raw::nBytes - (s_MantissaBits >> 3));
 	}
 
+	void Difficulty::GetTarget(Target& t) const
+	{
+		// IsTargetReached accepts hv * raw < 2^(256 + s_MantissaBits), the target is the largest such hv:
+		// (2^(256 + s_MantissaBits) - 1) / raw. With raw = mantissa * 2^order the dividend becomes
+		// 2^(256 + s_MantissaBits - order) - 1, so a division by the 25 bit mantissa is enough.
+		memset(t.m_pWord, 0, sizeof(t.m_pWord));
+		t.m_Valid = (m_Packed <= s_Inf);
+		if (!t.m_Valid)
+			return;
+
+		if (m_Packed == s_Inf)
+		{
+			// raw is 2^256 - 1
+			t.m_pWord[3] = 1ULL << s_MantissaBits;
+			return;
+		}
+
+		uint32_t order, mantissa;
+		Unpack(order, mantissa);
+
+		// Long division by 32 bit digits of the all ones dividend, the remainder stays below the mantissa
+		uint32_t nOnes = Raw::nBits + s_MantissaBits - order;
+		uint64_t rem = 0;
+		for (uint32_t i = (nOnes + 31) / 32; i-- > 0; )
+		{
+			uint32_t nDigitBits = std::min<uint32_t>(32, nOnes - 32 * i);
+			uint64_t cur = (rem << 32) | ((1ULL << nDigitBits) - 1);
+			uint64_t q = cur / mantissa;
+			rem = cur % mantissa;
+
+			if (i < 8)
+				t.m_pWord[3 - i / 2] |= q << (32 * (i & 1));
+			else
+				assert(!q);
+		}
+	}
+
 	void Difficulty::Unpack(Raw& res) const
 	{
 		res = Zero;
@@ -0,0 +1,302 @@
+// HDS OpenCL Miner
+// Asynchronous logging
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "hdsLog.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hdsMiner {
+
+std::atomic<uint32_t> logMinLevel{logInfo};
+
+namespace {
+
+	struct recordHeader {
+		uint32_t size;		// Bytes of the record including this header, 0 = continue at the start of the ring
+		uint32_t length;
+		int64_t timeUs;
+		uint32_t suppressed;
+		uint32_t level;
+	};
+
+	// Ring of variable sized records with one writing thread at a time and the drain thread as reader.
+	// A thread that ends gives its ring back, the next new thread continues to use it.
+	struct logRing {
+		static const uint32_t size = 1 << 16;
+
+		alignas(64) std::atomic<uint64_t> head{0};
+		alignas(64) std::atomic<uint64_t> tail{0};
+		std::atomic<uint64_t> dropped{0};
+		std::atomic<bool> owned{false};
+		uint32_t id;
+		char data[size];
+
+		void push(recordHeader rec, const char* text) {
+			uint32_t need = (sizeof(recordHeader) + rec.length + 7) & ~7u;
+			uint64_t pos = head.load(std::memory_order_relaxed);
+			uint32_t offset = pos & (size - 1);
+			uint32_t skip = (offset + need > size) ? (size - offset) : 0;
+
+			if (pos + skip + need - tail.load(std::memory_order_acquire) > size) {
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			if (skip > 0) {
+				uint32_t wrap = 0;
+				memcpy(data + offset, &wrap, sizeof(wrap));
+				pos += skip;
+				offset = 0;
+			}
+
+			rec.size = need;
+			memcpy(data + offset, &rec, sizeof(rec));
+			memcpy(data + offset + sizeof(rec), text, rec.length);
+			head.store(pos + need, std::memory_order_release);
+		}
+
+		template<typename F>
+		void pop(F&& handler) {
+			uint64_t pos = tail.load(std::memory_order_relaxed);
+			uint64_t end = head.load(std::memory_order_acquire);
+			while (pos != end) {
+				uint32_t offset = pos & (size - 1);
+				uint32_t recSize;
+				memcpy(&recSize, data + offset, sizeof(recSize));
+				if (recSize == 0) {
+					pos += size - offset;
+					continue;
+				}
+
+				recordHeader rec;
+				memcpy(&rec, data + offset, sizeof(rec));
+				handler(rec, data + offset + sizeof(rec));
+				pos += recSize;
+			}
+			tail.store(pos, std::memory_order_release);
+		}
+	};
+
+	struct pendingLine {
+		int64_t timeUs;
+		uint32_t level;
+		uint32_t thread;
+		uint32_t suppressed;
+		std::string text;
+	};
+
+	// Never destroyed, detached threads may still log while the process exits
+	struct logState {
+		std::mutex ringMutex;
+		std::vector<logRing*> rings;
+		std::mutex outputMutex;
+		std::atomic<uint32_t> rateLimit{20};
+		std::atomic<bool> running{false};
+		bool json = false;
+		std::string output;
+		std::vector<pendingLine> pending;
+	};
+
+	logState& state() {
+		static logState* s = new logState;
+		return *s;
+	}
+
+	struct ringHandle {
+		logRing* ring = nullptr;
+		~ringHandle() {
+			if (ring != nullptr) ring->owned.store(false, std::memory_order_release);
+		}
+	};
+
+	thread_local ringHandle threadRing;
+
+	logRing* acquireRing() {
+		logState& s = state();
+		std::lock_guard<std::mutex> lock(s.ringMutex);
+		for (logRing* ring : s.rings) {
+			if (!ring->owned.load(std::memory_order_acquire)) {
+				ring->owned.store(true, std::memory_order_relaxed);
+				return ring;
+			}
+		}
+
+		logRing* ring = new logRing;
+		ring->id = s.rings.size();
+		ring->owned.store(true, std::memory_order_relaxed);
+		s.rings.push_back(ring);
+		return ring;
+	}
+
+	const char* levelName(uint32_t level) {
+		static const char* names[] = {"debug", "info", "warning", "error"};
+		return (level < 4) ? names[level] : "info";
+	}
+
+	void appendJsonString(std::string& out, const std::string& text) {
+		out.push_back('"');
+		for (char c : text) {
+			if ((c == '"') || (c == '\\')) {
+				out.push_back('\\');
+				out.push_back(c);
+			} else if (c == '\n') {
+				out += "\\n";
+			} else if (c == '\r') {
+				out += "\\r";
+			} else if (c == '\t') {
+				out += "\\t";
+			} else if ((unsigned char) c < 0x20) {
+				char buf[8];
+				snprintf(buf, sizeof(buf), "\\u%04x", c);
+				out += buf;
+			} else {
+				out.push_back(c);
+			}
+		}
+		out.push_back('"');
+	}
+
+	void formatLine(logState& s, const pendingLine& line) {
+		if (!s.json) {
+			s.output += line.text;
+			if (line.suppressed > 0) s.output += " (" + std::to_string(line.suppressed) + " similar lines suppressed)";
+			s.output.push_back('\n');
+			return;
+		}
+
+		time_t seconds = line.timeUs / 1000000;
+		char timeBuf[32];
+		strftime(timeBuf, sizeof(timeBuf), "%Y-%m-%dT%H:%M:%S", std::gmtime(&seconds));
+		char msBuf[8];
+		snprintf(msBuf, sizeof(msBuf), ".%03dZ", (int) ((line.timeUs / 1000) % 1000));
+
+		s.output += "{\"time\":\"";
+		s.output += timeBuf;
+		s.output += msBuf;
+		s.output += "\",\"level\":\"";
+		s.output += levelName(line.level);
+		s.output += "\",\"thread\":" + std::to_string(line.thread) + ",\"msg\":";
+		appendJsonString(s.output, line.text);
+		if (line.suppressed > 0) s.output += ",\"suppressed\":" + std::to_string(line.suppressed);
+		s.output += "}\n";
+	}
+
+	// Moves the lines of all rings to stdout in the order they were logged
+	void drain() {
+		logState& s = state();
+		std::lock_guard<std::mutex> lock(s.outputMutex);
+
+		std::vector<logRing*> rings;
+		{
+			std::lock_guard<std::mutex> ringLock(s.ringMutex);
+			rings = s.rings;
+		}
+
+		s.pending.clear();
+		for (logRing* ring : rings) {
+			ring->pop([&](const recordHeader& rec, const char* text) {
+				std::string line(text, rec.length);
+				while (!line.empty() && (line.back() == '\n')) line.pop_back();
+				s.pending.push_back({rec.timeUs, rec.level, ring->id, rec.suppressed, std::move(line)});
+			});
+
+			uint64_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+			if (dropped > 0) {
+				int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+				s.pending.push_back({now, logWarning, ring->id, 0, "Warning: log buffer full, " + std::to_string(dropped) + " lines dropped"});
+			}
+		}
+
+		if (s.pending.empty()) return;
+
+		std::stable_sort(s.pending.begin(), s.pending.end(), [](const pendingLine& a, const pendingLine& b) {
+			return a.timeUs < b.timeUs;
+		});
+
+		s.output.clear();
+		for (auto& line : s.pending) formatLine(s, line);
+		fwrite(s.output.data(), 1, s.output.size(), stdout);
+		fflush(stdout);
+	}
+
+	void drainLoop() {
+		while (true) {
+			drain();
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+	}
+}
+
+
+logLine::logLine(logLevel levelIn, logSite* site) {
+	level = levelIn;
+	active = logEnabled(level);
+	if (!active) return;
+
+	timeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	// Allow rateLimit lines of this statement per second, the first line of the next second tells how many were left out
+	uint32_t limit = state().rateLimit.load(std::memory_order_relaxed);
+	if ((site != nullptr) && (limit > 0)) {
+		uint32_t second = (uint32_t) (timeUs / 1000000);
+		if (site->second.load(std::memory_order_relaxed) != second) {
+			site->second.store(second, std::memory_order_relaxed);
+			site->count.store(0, std::memory_order_relaxed);
+			suppressed = site->suppressed.exchange(0, std::memory_order_relaxed);
+		}
+
+		if (site->count.fetch_add(1, std::memory_order_relaxed) >= limit) {
+			site->suppressed.fetch_add(1, std::memory_order_relaxed);
+			active = false;
+		}
+	}
+}
+
+
+logLine::~logLine() {
+	if (!active) return;
+
+	if (threadRing.ring == nullptr) threadRing.ring = acquireRing();
+
+	recordHeader rec;
+	rec.size = 0;
+	rec.length = length;
+	rec.timeUs = timeUs;
+	rec.suppressed = suppressed;
+	rec.level = level;
+	threadRing.ring->push(rec, text);
+
+	// Until the drain thread runs lines are written right away
+	if (!state().running.load(std::memory_order_relaxed)) drain();
+}
+
+
+void flushLog() {
+	drain();
+}
+
+
+void startLogging(logConfig config) {
+	logState& s = state();
+	{
+		std::lock_guard<std::mutex> lock(s.outputMutex);
+		s.json = config.json;
+	}
+	s.rateLimit.store(config.rateLimit, std::memory_order_relaxed);
+	logMinLevel.store(config.level, std::memory_order_relaxed);
+
+	if (!s.running.exchange(true)) {
+		atexit(flushLog);
+		std::thread(drainLoop).detach();
+	}
+}
+
+}
@@ -0,0 +1,145 @@
+// HDS OpenCL Miner
+// Asynchronous logging
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#ifndef hdsLog_h
+#define hdsLog_h
+
+namespace hdsMiner {
+
+	enum logLevel {logDebug, logInfo, logWarning, logError, logOff};
+
+	struct logConfig {
+		logLevel level = logInfo;
+		bool json = false;		// One JSON object per line instead of plain text
+		uint32_t rateLimit = 20;	// Lines per second of one log statement, 0 = unlimited
+	};
+
+	extern std::atomic<uint32_t> logMinLevel;
+
+	inline bool logEnabled(logLevel level) {
+		return level >= logMinLevel.load(std::memory_order_relaxed);
+	}
+
+	// Starts the drain thread, before that lines are written directly
+	void startLogging(logConfig);
+
+	// Writes all pending lines, call before the process exits
+	void flushLog();
+
+	// State of one log statement for the rate limit, created once per call site by HDS_LOG
+	struct logSite {
+		std::atomic<uint32_t> second{0};
+		std::atomic<uint32_t> count{0};
+		std::atomic<uint32_t> suppressed{0};
+	};
+
+	// Fixed point output with the given digits for the following floating point values
+	struct logPrecision {
+		int digits;
+		explicit logPrecision(int d) : digits(d) {}
+	};
+
+	// One line, formatted on the calling thread into a stack buffer without allocation and
+	// handed to the ring buffer of the thread when it goes out of scope
+	class logLine {
+		private:
+		static const uint32_t maxLength = 2048;
+		char text[maxLength];
+		uint32_t length = 0;
+		int64_t timeUs;
+		uint32_t suppressed = 0;
+		int precision = -1;
+		logLevel level;
+		bool active;
+
+		void append(const char* data, size_t size) {
+			size = std::min<size_t>(size, maxLength - length);
+			memcpy(text + length, data, size);
+			length += size;
+		}
+
+		public:
+		logLine(logLevel, logSite* site = nullptr);
+		~logLine();
+
+		logLine& operator<<(const char* str) {
+			if (active) append(str, strlen(str));
+			return *this;
+		}
+
+		logLine& operator<<(const std::string& str) {
+			if (active) append(str.data(), str.size());
+			return *this;
+		}
+
+		logLine& operator<<(char c) {
+			if (active) append(&c, 1);
+			return *this;
+		}
+
+		logLine& operator<<(bool value) {
+			return *this << (value ? "true" : "false");
+		}
+
+		logLine& operator<<(logPrecision p) {
+			precision = p.digits;
+			return *this;
+		}
+
+		template<typename T>
+		typename std::enable_if<std::is_integral<T>::value, logLine&>::type operator<<(T value) {
+			if (active) {
+				char buf[24];
+				auto res = std::to_chars(buf, buf + sizeof(buf), value);
+				append(buf, res.ptr - buf);
+			}
+			return *this;
+		}
+
+		template<typename T>
+		typename std::enable_if<std::is_floating_point<T>::value, logLine&>::type operator<<(T value) {
+			if (active) {
+				char buf[64];
+				auto res = (precision >= 0) ? std::to_chars(buf, buf + sizeof(buf), (double) value, std::chars_format::fixed, precision)
+							    : std::to_chars(buf, buf + sizeof(buf), (double) value, std::chars_format::general, 6);
+				append(buf, (res.ec == std::errc()) ? (res.ptr - buf) : 0);
+			}
+			return *this;
+		}
+
+		// Everything else that can be written to a stream, like endpoints
+		template<typename T>
+		typename std::enable_if<!std::is_arithmetic<T>::value && !std::is_convertible<T, const char*>::value, logLine&>::type operator<<(const T& value) {
+			if (active) {
+				std::ostringstream stream;
+				stream << value;
+				*this << stream.str();
+			}
+			return *this;
+		}
+	};
+
+	struct logVoidify {
+		void operator&(logLine&) {}
+		void operator&(logLine&&) {}
+	};
+}
+
+// Usage: HDS_LOG(hdsMiner::logInfo) << "New job: " << id;
+// A disabled level costs one relaxed load, the arguments are not evaluated then.
+#define HDS_LOG(level) \
+	!hdsMiner::logEnabled(level) ? (void) 0 : hdsMiner::logVoidify() & hdsMiner::logLine(level, \
+		[]() -> hdsMiner::logSite* { static hdsMiner::logSite site; return &site; }())
+
+#endif
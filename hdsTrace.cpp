@@ -0,0 +1,178 @@
+// HDS OpenCL Miner
+// Timeline trace in the Chrome trace event format
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "hdsTrace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace hdsMiner {
+
+std::atomic<bool> traceActive{false};
+
+namespace {
+
+	// The host threads are one process of the trace, the devices another with one track each
+	const uint32_t hostPid = 1;
+	const uint32_t devicePid = 2;
+
+	struct traceState {
+		std::mutex mutex;
+		FILE* file = nullptr;
+		std::string buffer;
+		bool first = true;
+		std::chrono::steady_clock::time_point start;
+		int64_t endUs = 0;
+		int64_t lastFlushUs = 0;
+		std::atomic<uint32_t> nextThread{1};
+	};
+
+	// Never destroyed, other threads may still trace while the process exits
+	traceState& state() {
+		static traceState* s = new traceState;
+		return *s;
+	}
+
+	thread_local uint32_t threadTrack = 0;
+
+	void appendEscaped(std::string& out, const std::string& text) {
+		for (char c : text) {
+			if ((c == '"') || (c == '\\')) out.push_back('\\');
+			if ((unsigned char) c >= 0x20) out.push_back(c);
+		}
+	}
+
+	void flushLocked(traceState& s) {
+		if (s.file == nullptr) return;
+		fwrite(s.buffer.data(), 1, s.buffer.size(), s.file);
+		fflush(s.file);
+		s.buffer.clear();
+	}
+
+	void closeLocked(traceState& s) {
+		traceActive.store(false);
+		if (s.file == nullptr) return;
+		s.buffer += "\n]\n";
+		flushLocked(s);
+		fclose(s.file);
+		s.file = nullptr;
+	}
+
+	// Adds one event, written out once a second. Recording ends when the trace time is over.
+	void addEvent(const std::string& event, int64_t now) {
+		traceState& s = state();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		if (s.file == nullptr) return;
+
+		if (!s.first) s.buffer += ",\n";
+		s.first = false;
+		s.buffer += event;
+
+		if (now > s.endUs) {
+			closeLocked(s);
+		} else if (now - s.lastFlushUs > 1000000) {
+			flushLocked(s);
+			s.lastFlushUs = now;
+		}
+	}
+
+	void atExit() {
+		traceState& s = state();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		closeLocked(s);
+	}
+
+	std::string metaEvent(const char* kind, uint32_t pid, uint32_t tid, const std::string& name) {
+		std::string event = "{\"name\":\"";
+		event += kind;
+		event += "\",\"ph\":\"M\",\"pid\":" + std::to_string(pid) + ",\"tid\":" + std::to_string(tid) + ",\"args\":{\"name\":\"";
+		appendEscaped(event, name);
+		event += "\"}}";
+		return event;
+	}
+
+	uint32_t currentTrack() {
+		if (threadTrack == 0) {
+			threadTrack = state().nextThread.fetch_add(1);
+			addEvent(metaEvent("thread_name", hostPid, threadTrack, "Thread " + std::to_string(threadTrack)), traceNow());
+		}
+		return threadTrack;
+	}
+
+	std::string event(const char* name, const char* category, char phase, uint32_t pid, uint32_t tid, int64_t ts, int64_t dur, const std::string& args) {
+		std::string e = "{\"name\":\"";
+		e += name;
+		e += "\",\"cat\":\"";
+		e += category;
+		e += "\",\"ph\":\"";
+		e.push_back(phase);
+		e += "\",\"pid\":" + std::to_string(pid) + ",\"tid\":" + std::to_string(tid) + ",\"ts\":" + std::to_string(ts);
+		if (phase == 'X') e += ",\"dur\":" + std::to_string(dur);
+		if (phase == 'i') e += ",\"s\":\"t\"";
+		if (!args.empty()) e += ",\"args\":{" + args + "}";
+		e += "}";
+		return e;
+	}
+}
+
+
+int64_t traceNow() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - state().start).count();
+}
+
+
+bool startTrace(const std::string& fileName, uint32_t seconds) {
+	traceState& s = state();
+	{
+		std::lock_guard<std::mutex> lock(s.mutex);
+		s.file = fopen(fileName.c_str(), "w");
+		if (s.file == nullptr) return false;
+
+		s.start = std::chrono::steady_clock::now();
+		s.endUs = (int64_t) seconds * 1000000;
+		s.buffer = "[\n";
+	}
+
+	addEvent(metaEvent("process_name", hostPid, 0, "Host"), 0);
+	addEvent(metaEvent("process_name", devicePid, 0, "Devices"), 0);
+	atexit(atExit);
+	traceActive.store(true);
+	return true;
+}
+
+
+void traceThreadName(const std::string& name) {
+	if (!traceEnabled()) return;
+	addEvent(metaEvent("thread_name", hostPid, currentTrack(), name), traceNow());
+}
+
+
+void traceDeviceName(uint32_t gpu, const std::string& name) {
+	if (!traceEnabled()) return;
+	addEvent(metaEvent("thread_name", devicePid, gpu, name), traceNow());
+}
+
+
+void traceSpan(const char* name, const char* category, int64_t start, int64_t duration, const std::string& args) {
+	if (!traceEnabled()) return;
+	addEvent(event(name, category, 'X', hostPid, currentTrack(), start, duration, args), start + duration);
+}
+
+
+void traceDeviceSpan(uint32_t gpu, const char* name, int64_t start, int64_t duration, const std::string& args) {
+	if (!traceEnabled()) return;
+	addEvent(event(name, "gpu", 'X', devicePid, gpu, start, duration, args), start + duration);
+}
+
+
+void traceInstant(const char* name, const char* category, const std::string& args) {
+	if (!traceEnabled()) return;
+	int64_t now = traceNow();
+	addEvent(event(name, category, 'i', hostPid, currentTrack(), now, 0, args), now);
+}
+
+}
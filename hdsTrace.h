@@ -0,0 +1,60 @@
+// HDS OpenCL Miner
+// Timeline trace in the Chrome trace event format
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#ifndef hdsTrace_h
+#define hdsTrace_h
+
+namespace hdsMiner {
+
+	extern std::atomic<bool> traceActive;
+
+	inline bool traceEnabled() {
+		return traceActive.load(std::memory_order_relaxed);
+	}
+
+	// Records for the given time, then closes the file. The JSON opens in chrome://tracing and ui.perfetto.dev
+	bool startTrace(const std::string&, uint32_t);
+
+	// Microseconds since the start of the trace
+	int64_t traceNow();
+
+	// Names the track of the calling thread
+	void traceThreadName(const std::string&);
+	void traceDeviceName(uint32_t, const std::string&);
+
+	// Complete spans and instant events. Args is the inside of a JSON object, like "\"workId\":5"
+	void traceSpan(const char*, const char*, int64_t, int64_t, const std::string& args = "");
+	void traceDeviceSpan(uint32_t, const char*, int64_t, int64_t, const std::string& args = "");
+	void traceInstant(const char*, const char*, const std::string& args = "");
+
+	// Span from construction to destruction on the track of the calling thread
+	class traceScope {
+		private:
+		const char* name;
+		const char* category;
+		int64_t start = 0;
+		bool active;
+
+		public:
+		std::string args;
+
+		traceScope(const char* nameIn, const char* categoryIn) : name(nameIn), category(categoryIn) {
+			active = traceEnabled();
+			if (active) start = traceNow();
+		}
+
+		~traceScope() {
+			if (active) traceSpan(name, category, start, traceNow() - start, args);
+		}
+
+		bool enabled() { return active; }
+	};
+}
+
+#endif
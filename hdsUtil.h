@@ -1,6 +1,7 @@
 
 
 #include "core/difficulty.h"
+#include <chrono>
 
 #ifndef hdsUtil_h
 #define hdsUtil_h
@@ -12,9 +13,18 @@ namespace hdsMiner {
 	struct WorkDescription 	{
 		solverType solver;
 		int64_t workId;
+		uint64_t epoch;
 		uint64_t nonce;
+		uint64_t nonceStep;		// Value to add to nonce for the next nonce of this miner
+		uint32_t extraNonce;
+		bool devicePrePow = false;	// HdsHash III: work holds the header, the GPU derives the prePow
+		uint32_t iterations = 1;	// Consecutive nonces (nonce + i*nonceStep) covered by this work
+		uint32_t device = 0;		// Index of the device, selects its nonce partition
+		solverType nextSolver = None;	// Solver of the fork coming up within the pre-staging distance
 		uint64_t work[4];
 		hds::Difficulty powDiff;
+		hds::Difficulty::Target powTarget;
+		std::chrono::steady_clock::time_point jobReceived;
 	};
 
 	struct clCallbackData {
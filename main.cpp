@@ -4,8 +4,14 @@
 // Copyright 2020 Wilke Trei
 
 #include "hdsStratum.h"
+#include "stratumProxy.h"
+#include "minerApi.h"
 #include "clHost.h"
 #include "hdsUtil.h"
+#include "hdsLog.h"
+#include "hdsTrace.h"
+#include "crypto/sha256.h"
+#include "crypto/blake2b.h"
 
 // Defining global variables
 const string StrVersionNumber = "v2.0";
@@ -26,7 +32,16 @@ inline vector<string> split(const string &s, char delim) {
     return split(s, delim, elems);
 }
 
-uint32_t cmdParser(vector<string> args, string &host, string &port, string &apiCred, bool &debug, hdsMiner::solverType &forcedSolver, vector<int32_t> &devices) {
+// Settings of one device group, every group mines with its own stratum session
+struct deviceGroup {
+	vector<hdsMiner::poolAddress> pools;
+	string apiCred;
+	hdsMiner::solverType forcedSolver = hdsMiner::None;
+	vector<int32_t> devices;
+	hdsMiner::stratumConfig stratConfig;
+};
+
+uint32_t cmdParser(vector<string> args, vector<hdsMiner::poolAddress> &pools, string &apiCred, bool &debug, hdsMiner::solverType &forcedSolver, vector<int32_t> &devices, hdsMiner::clHostConfig &clConfig, hdsMiner::stratumConfig &stratConfig, hdsMiner::apiConfig &apiConfig, hdsMiner::logConfig &logConf, string &traceFile, uint32_t &traceSeconds) {
 	bool hostSet = false;
 	bool apiSet = false;
 	
@@ -38,14 +53,20 @@ uint32_t cmdParser(vector<string> args, string &host, string &port, string &apiC
 
 			if (args[i].compare("--server")  == 0) {
 				if (i+1 < args.size()) {
-					vector<string> tmp = split(args[i+1], ':');
-					if (tmp.size() == 2) {
-						host = tmp[0];
-						port = tmp[1];
-						hostSet = true;	
-						i++;
-						continue;
+					// A comma seperated list gives failover pools in order of priority
+					vector<string> servers = split(args[i+1], ',');
+					for (uint32_t j=0; j<servers.size(); j++) {
+						vector<string> tmp = split(servers[j], ':');
+						if (tmp.size() == 2) {
+							hdsMiner::poolAddress pool;
+							pool.host = tmp[0];
+							pool.port = tmp[1];
+							pools.push_back(pool);
+							hostSet = true;	
+						}
 					}
+					i++;
+					continue;
 				}
 			}
 
@@ -61,7 +82,7 @@ uint32_t cmdParser(vector<string> args, string &host, string &port, string &apiC
 			if (args[i].compare("--devices")  == 0) {
 				if (i+1 < args.size()) {
 					vector<string> tmp = split(args[i+1], ',');
-					for (int j=0; j<tmp.size(); j++) {
+					for (uint32_t j=0; j<tmp.size(); j++) {
 						devices.push_back(stoi(tmp[j]));
 					}
 					continue;
@@ -80,6 +101,179 @@ uint32_t cmdParser(vector<string> args, string &host, string &port, string &apiC
 				forcedSolver = hdsMiner::HdsIII;
 			}
 
+			if (args[i].compare("--gpuPrePow")  == 0) {
+				clConfig.devicePrePow = true;
+			}
+
+			if (args[i].compare("--batch")  == 0) {
+				if (i+1 < args.size()) {
+					clConfig.batchSize = max(1, min(64, stoi(args[i+1])));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--prestage")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.prestageBlocks = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--staleWindow")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.staleWindowMs = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--reconnectGrace")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.reconnectGraceSec = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--failback")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.failbackSec = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--latencySwitch")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.latencySwitchMs = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--proxy")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.proxyPort = max(0, min(65535, stoi(args[i+1])));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--nonceInstance")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.nonceInstance = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--nonceInstanceBits")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.instanceBits = max(1, min(24, stoi(args[i+1])));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--nonceDeviceBits")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.deviceBits = max(0, min(16, stoi(args[i+1])));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--nonceLease")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.nonceLease = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--capture")  == 0) {
+				if (i+1 < args.size()) {
+					stratConfig.captureFile = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--api")  == 0) {
+				if (i+1 < args.size()) {
+					size_t colon = args[i+1].rfind(':');
+					if (colon != string::npos) apiConfig.address = args[i+1].substr(0, colon);
+					apiConfig.port = max(0, min(65535, stoi(args[i+1].substr(colon == string::npos ? 0 : colon+1))));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--apiToken")  == 0) {
+				if (i+1 < args.size()) {
+					apiConfig.token = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--apiSocket")  == 0) {
+				if (i+1 < args.size()) {
+					apiConfig.socketPath = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--logLevel")  == 0) {
+				if (i+1 < args.size()) {
+					if (args[i+1] == "debug") logConf.level = hdsMiner::logDebug;
+					if (args[i+1] == "info") logConf.level = hdsMiner::logInfo;
+					if (args[i+1] == "warning") logConf.level = hdsMiner::logWarning;
+					if (args[i+1] == "error") logConf.level = hdsMiner::logError;
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--logRate")  == 0) {
+				if (i+1 < args.size()) {
+					logConf.rateLimit = max(0, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--trace")  == 0) {
+				if (i+1 < args.size()) {
+					traceFile = args[i+1];
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--traceTime")  == 0) {
+				if (i+1 < args.size()) {
+					traceSeconds = max(1, stoi(args[i+1]));
+					i++;
+					continue;
+				}
+			}
+
+			if (args[i].compare("--logJson")  == 0) {
+				logConf.json = true;
+			}
+
+			if (args[i].compare("--allowCPU")  == 0) {
+				clConfig.allowCPU = true;
+			}
+
+			if (args[i].compare("--noTLS")  == 0) {
+				stratConfig.useTLS = false;
+			}
+
 			if (args[i].compare("--debug")  == 0) {
 				debug = true;
 			}
@@ -106,16 +300,42 @@ int main(int argc, char* argv[]) {
 	
 
 	vector<string> cmdLineArgs(argv, argv+argc);
-	string host;
-	string port;
-	string apiCred;
 	bool debug = false;
-	hdsMiner::solverType forcedSolver = hdsMiner::None;
-	bool useTLS = true;
-	vector<int32_t> devices;
+	hdsMiner::clHostConfig clConfig;
+	hdsMiner::apiConfig apiConfig;
+	hdsMiner::logConfig logConf;
+	string traceFile;
+	uint32_t traceSeconds = 60;
+
+	// Every --group starts the parameters of another device group
+	vector< vector<string> > groupArgs(1);
+	for (auto &arg : cmdLineArgs) {
+		if (arg.compare("--group") == 0) {
+			groupArgs.emplace_back();
+		} else {
+			groupArgs.back().push_back(arg);
+		}
+	}
 
+	vector<deviceGroup> groups(groupArgs.size());
+	uint32_t parsing = cmdParser(groupArgs[0], groups[0].pools, groups[0].apiCred, debug, groups[0].forcedSolver, groups[0].devices, clConfig, groups[0].stratConfig, apiConfig, logConf, traceFile, traceSeconds);
+
+	// Further groups start with the key, solver and stratum options of the first one, but need their own servers and devices
+	for (uint32_t g=1; g<groups.size(); g++) {
+		groups[g].apiCred = groups[0].apiCred;
+		groups[g].forcedSolver = groups[0].forcedSolver;
+		groups[g].stratConfig = groups[0].stratConfig;
+		groups[g].stratConfig.captureFile.clear();
+		groups[g].stratConfig.proxyPort = 0;
+
+		uint32_t res = cmdParser(groupArgs[g], groups[g].pools, groups[g].apiCred, debug, groups[g].forcedSolver, groups[g].devices, clConfig, groups[g].stratConfig, apiConfig, logConf, traceFile, traceSeconds);
+		if (groups[g].apiCred.size() > 0) res &= ~0x2;
+		if (groups[g].devices[0] == -1) res |= 0x8;
+		parsing |= res;
+	}
 
-	uint32_t parsing = cmdParser(cmdLineArgs, host, port, apiCred, debug, forcedSolver, devices);
+	vector<hdsMiner::poolAddress> &pools = groups[0].pools;
+	hdsMiner::stratumConfig &stratConfig = groups[0].stratConfig;
 
 	cout << "-====================================-" << endl;
 	cout << "                                      " << endl;
@@ -126,9 +346,19 @@ int main(int argc, char* argv[]) {
 	cout << "-====================================-" << endl;
 	cout << "" << endl;	
 	cout << "Parameters: " << endl;
-	cout << " --server:      " << host << ":" << port << endl;	
-	cout << " --key:         " << apiCred << endl;
+	for (uint32_t g=0; g<groups.size(); g++) {
+		if (groups.size() > 1) cout << " Group " << g << ":" << endl;
+		for (uint32_t i=0; i<groups[g].pools.size(); i++) {
+			cout << " --server:      " << groups[g].pools[i].host << ":" << groups[g].pools[i].port << ((i > 0) ? " (failover)" : "") << endl;	
+		}
+		cout << " --key:         " << groups[g].apiCred << endl;
+	}
 	cout << " --debug:       " << std::boolalpha << debug << endl;
+	if (!stratConfig.useTLS) cout << " --noTLS:       true" << endl;
+	if (stratConfig.proxyPort > 0) cout << " --proxy:       " << stratConfig.proxyPort << endl;
+	if (apiConfig.port > 0) cout << " --api:         " << apiConfig.address << ":" << apiConfig.port << endl;
+	if (apiConfig.socketPath.size() > 0) cout << " --apiSocket:   " << apiConfig.socketPath << endl;
+	cout << " --batch:       " << clConfig.batchSize << endl;
 
 	if (parsing != 0) {
 		if (parsing & 0x1) {
@@ -139,42 +369,105 @@ int main(int argc, char* argv[]) {
 			cout << "Error: Parameter --key missing" << endl;
 		}
 
+		if (parsing & 0x8) {
+			cout << "Error: Parameter --devices missing in a device group" << endl;
+		}
+
 		cout << "Parameters: " << endl;
 		cout << " --help / -h 			Showing this message" << endl;
-		cout << " --server <server>:<port>	The HDS stratum server and port to connect to (required)" << endl;
+		cout << " --server <server>:<port>	The HDS stratum server and port to connect to (required), more servers seperated by comma are failover pools" << endl;
 		cout << " --key <key>			The HDS stratum server API key (required), on a Hds mining pool the user name / wallet addres" << endl;
 		cout << " --devices <numbers>		A comma seperated list of devices that should be used for mining (default: all in system)" << endl; 
 		cout << " --hdsHashI			Force mining Hds Hash I" << endl;
 		cout << " --hdsHashII			Force mining Hds Hash II" << endl;
 		cout << " --hdsHashIII			Force mining Hds Hash III" << endl;
+		cout << " --gpuPrePow			Compute the Hds Hash III prePow on the GPU instead of the CPU" << endl;
+		cout << " --batch <iterations>		Hds Hash III iterations per GPU launch (default: 1, implies --gpuPrePow)" << endl;
+		cout << " --prestage <blocks>		Prepare the solver of a PoW fork this many blocks ahead (default: 5, 0 = off)" << endl;
+		cout << " --staleWindow <ms>		Time solutions for a replaced job are still submitted and its launches run on (default: 3000)" << endl;
+		cout << " --reconnectGrace <sec>		Keep mining the last job while reconnecting for this long (default: 30, 0 = off)" << endl;
+		cout << " --failback <sec>		Switch back to a pool with higher priority once it is up this long (default: 120, 0 = never)" << endl;
+		cout << " --latencySwitch <ms>		Switch pools when the active one is this much slower than another (default: 1000, 0 = off)" << endl;
+		cout << " --proxy <port>			Do not mine, serve the jobs to other miners connecting on this port without TLS" << endl;
+		cout << " --nonceInstance <n>		Number of this miner, miners with the same key and different numbers never share nonces" << endl;
+		cout << " --nonceInstanceBits <bits>	Nonce bits reserved for the instance number (default: 8)" << endl;
+		cout << " --nonceDeviceBits <bits>	Nonce bits reserved for the device index (default: as many as the devices need)" << endl;
+		cout << " --nonceLease <file>		Lease file that gives each miner process on this host its own instance number" << endl;
+		cout << " --group			Start the parameters of another device group, with its own servers, key, devices and solver" << endl;
+		cout << " --capture <file>		Record the stratum traffic to a binary file, it can be replayed with the mock pool" << endl;
+		cout << " --api <[address:]port>		Serve metrics and control commands over HTTP (default address: 127.0.0.1)" << endl;
+		cout << " --apiToken <secret>		Allow control commands over HTTP with this value in the X-Hds-Token header" << endl;
+		cout << " --apiSocket <path>		Serve metrics and control commands as JSON lines on a Unix socket" << endl;
+		cout << " --logLevel <level>		Show messages from this level on: debug, info, warning or error (default: info)" << endl;
+		cout << " --logRate <lines>		Lines per second one message may print before further ones are suppressed (default: 20, 0 = off)" << endl;
+		cout << " --trace <file>			Record a timeline of the devices and the stratum traffic for chrome://tracing or ui.perfetto.dev" << endl;
+		cout << " --traceTime <sec>		Length of the recorded timeline (default: 60)" << endl;
+		cout << " --logJson			Write the log as one JSON object per line" << endl;
+		cout << " --allowCPU			Also mine on CPU OpenCL devices (for tests without GPU)" << endl;
+		cout << " --noTLS			Plain TCP connection without encryption, for a node on localhost or in the LAN only" << endl;
 		cout << " --debug			Enable debug mode - verbose stratum information will be displayed" << endl;
 		cout << " --version			Prints the version number" << endl;
 		exit(0);
 	}
 
-	hdsMiner::hdsStratum myStratum(host, port, apiCred, debug, forcedSolver);
+	clConfig.debug = debug;
+
+	if (debug) logConf.level = hdsMiner::logDebug;
+	hdsMiner::startLogging(logConf);
+	HDS_LOG(hdsMiner::logDebug) << "SHA-256 implementation for share checks: " << Sha256_Implementation();
+	HDS_LOG(hdsMiner::logDebug) << "Blake2b batch implementation: " << blake2bImplementation();
+
+	// Before the devices are set up, their queues need profiling for the trace
+	if (traceFile.size() > 0) {
+		if (hdsMiner::startTrace(traceFile, traceSeconds)) {
+			HDS_LOG(hdsMiner::logInfo) << "Recording a trace to " << traceFile << " for " << traceSeconds << " seconds";
+		} else {
+			HDS_LOG(hdsMiner::logWarning) << "Warning: can not open trace file " << traceFile;
+		}
+	}
+
+	// In proxy mode the jobs go to downstream miners instead of local devices
+	if (stratConfig.proxyPort > 0) {
+		hdsMiner::hdsStratum myStratum(pools, groups[0].apiCred, debug, groups[0].forcedSolver, stratConfig);
+		hdsMiner::stratumProxy myProxy(&myStratum, stratConfig.proxyPort, debug);
+		myStratum.startWorking();
+		myProxy.run();
+		return 0;
+	}
+
+	vector< std::unique_ptr<hdsMiner::hdsStratum> > myStratums;
+	vector<hdsMiner::hdsStratum*> stratumList;
+	vector< vector<int32_t> > deviceList;
+	for (auto &group : groups) {
+		myStratums.emplace_back(new hdsMiner::hdsStratum(group.pools, group.apiCred, debug, group.forcedSolver, group.stratConfig));
+		stratumList.push_back(myStratums.back().get());
+		deviceList.push_back(group.devices);
+	}
 
 	hdsMiner::clHost myClHost;
 	
-	cout << endl;
-	cout << "Setup OpenCL devices:" << endl;
-	cout << "=====================" << endl;
+	HDS_LOG(hdsMiner::logInfo) << "\nSetup OpenCL devices:\n=====================";
 	
-	myClHost.setup(&myStratum, devices);
+	myClHost.setup(stratumList, deviceList, clConfig);
+
+	std::unique_ptr<hdsMiner::minerApi> myApi;
+	if ((apiConfig.port > 0) || (apiConfig.socketPath.size() > 0)) {
+		myApi.reset(new hdsMiner::minerApi(&myClHost, stratumList, apiConfig));
+		myApi->start();
+	}
 
-	cout << endl;
-	cout << "Waiting for work from stratum:" << endl;
-	cout << "==============================" << endl;
+	HDS_LOG(hdsMiner::logInfo) << "\nWaiting for work from stratum:\n==============================";
 
-	myStratum.startWorking();
+	for (auto &stratum : myStratums) stratum->startWorking();
 
-	while (!myStratum.hasWork()) {
+	// Groups without work yet start as soon as their first job arrives
+	bool hasWork = false;
+	while (!hasWork) {
 		this_thread::sleep_for(std::chrono::milliseconds(200));
+		for (auto &stratum : myStratums) hasWork |= stratum->hasWork();
 	}
 
-	cout << endl;
-	cout << "Start mining:" << endl;
-	cout << "=============" << endl;
+	HDS_LOG(hdsMiner::logInfo) << "\nStart mining:\n=============";
 	myClHost.startMining();
 }
 
@@ -12,69 +12,57 @@
 
 namespace hdsMiner {
 
-void hdsHashIII_S::loadAndCompileKernel(cl::Context &context, cl::Device &device, uint32_t index) {
-
-	// Source Code of the solver
-	string progStr = string((const char*) __hds_hash_III_cl, __hds_hash_III_cl_len);
-	cl::Program::Sources source(1,std::make_pair(progStr.c_str(), progStr.length()+1));
-
-	vector<cl::Device> devicesTMP;
-	devicesTMP.push_back(device);
-
-	// Building the program for the device
-	cl::Program program(context, source);
-	cl_int err;
-	err = program.build(devicesTMP,"-DwgSize=256");
-
-	// Create the Kernels
-	kernels[index].push_back(cl::Kernel(program, "cleanUp", &err));
-	kernels[index].push_back(cl::Kernel(program, "hdsHashIII_seed", &err));
-	kernels[index].push_back(cl::Kernel(program, "hdsHashIII_R1", &err));
-	kernels[index].push_back(cl::Kernel(program, "hdsHashIII_R2", &err));
-	kernels[index].push_back(cl::Kernel(program, "hdsHashIII_R3", &err));
-	kernels[index].push_back(cl::Kernel(program, "hdsHashIII_R4", &err));
-	kernels[index].push_back(cl::Kernel(program, "hdsHashIII_R5", &err));
-	kernels[index].push_back(cl::Kernel(program, "watch_counter", &err));
-}
-
-
-void hdsHashIII_S::createBuffers(cl::Context &context, cl::Device &device, uint32_t index) {
-	cl_int err;
-	buffers[index].push_back(cl::Buffer(context, CL_MEM_READ_WRITE,  sizeof(cl_ulong8) * 35717120, NULL, &err));
-	buffers[index].push_back(cl::Buffer(context, CL_MEM_READ_WRITE,  sizeof(cl_ulong8) * 35717120, NULL, &err));
-	buffers[index].push_back(cl::Buffer(context, CL_MEM_READ_WRITE,  sizeof(cl_uint) * 20480, NULL, &err));  
-	buffers[index].push_back(cl::Buffer(context, CL_MEM_READ_WRITE,  sizeof(cl_uint) * 324, NULL, &err));  
-}
-
-
-void hdsHashIII_S::queueKernels(cl::CommandQueue * queue, uint32_t devInd,  cl::Event * cbEvent, clCallbackData * workData) {
-
-	cl_ulong4 prePow;
-	memcpy(&prePow, &(workData->wd.work[0]), 32);	
-
-	cl_int err;
-
-	for (uint32_t kInd=0; kInd < kernels[devInd].size(); kInd++) {
-		// Set the buffers as arguments
-		err = kernels[devInd][kInd].setArg(0, buffers[devInd][0]); 
-		err = kernels[devInd][kInd].setArg(1, buffers[devInd][1]); 
-		err = kernels[devInd][kInd].setArg(2, buffers[devInd][2]); 
-		err = kernels[devInd][kInd].setArg(3, buffers[devInd][3]); 
-		// Set the work as argument
-		err = kernels[devInd][kInd].setArg(4, prePow); 
-	}
-	
-	uint32_t  wgSize = 256;
-
-	queue->enqueueNDRangeKernel(kernels[devInd][0], cl::NDRange(0), cl::NDRange(5120), cl::NDRange(wgSize), NULL, NULL);	// cleanUp
-	queue->enqueueNDRangeKernel(kernels[devInd][1], cl::NDRange(0), cl::NDRange(33554432), cl::NDRange(wgSize), NULL, NULL);	// seed
-	queue->enqueueNDRangeKernel(kernels[devInd][2], cl::NDRange(0), cl::NDRange(16384*wgSize), cl::NDRange(wgSize), NULL, NULL);	// Round 1
-	queue->enqueueNDRangeKernel(kernels[devInd][3], cl::NDRange(0), cl::NDRange(16384*wgSize), cl::NDRange(wgSize), NULL, NULL);	// Round 2
-	queue->enqueueNDRangeKernel(kernels[devInd][4], cl::NDRange(0), cl::NDRange(16384*wgSize), cl::NDRange(wgSize), NULL, NULL);	// Round 3
-	queue->enqueueNDRangeKernel(kernels[devInd][5], cl::NDRange(0), cl::NDRange(16384*wgSize), cl::NDRange(wgSize), NULL, NULL);	// Round 4
-	queue->enqueueNDRangeKernel(kernels[devInd][6], cl::NDRange(0), cl::NDRange(16384*wgSize), cl::NDRange(wgSize), NULL, NULL);	// Round 5
-
-	results[devInd] = (uint32_t *) queue->enqueueMapBuffer(buffers[devInd][3], CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint4) * 81, NULL, cbEvent, NULL);	// Read the Results
+solverSpec hdsHashIIISpec() {
+	const uint32_t wgSize = 256;
+
+	solverSpec spec;
+	spec.source = __hds_hash_III_cl;
+	spec.sourceLength = __hds_hash_III_cl_len;
+	spec.buildOptions = "-DwgSize=" + to_string(wgSize);
+
+	spec.buffers = {
+		{sizeof(cl_ulong8) * 35717120, false},
+		{sizeof(cl_ulong8) * 35717120, false},
+		{sizeof(cl_uint) * 20480, false},
+		{sizeof(cl_ulong4), true},			// prePow ring
+		{sizeof(cl_uint) * resultSlotSize, true}	// Result slot ring
+	};
+	spec.resultBuffer = 4;
+
+	// Of the arguments that change seed and seedDev read the prePow, they and the rounds read the
+	// epoch. cleanUp and watch_counter share the signature and get placeholders.
+	auto b = [](uint32_t index) { return argSpec(argBuffer, index); };
+	vector<argSpec> common = {b(0), b(1), b(2), b(4), argUnusedUlong4, argSlot, argEpochBuffer, argUnusedUint};
+	vector<argSpec> round = {b(0), b(1), b(2), b(4), argUnusedUlong4, argSlot, argEpochBuffer, argEpoch};
+	vector<argSpec> seed = {b(0), b(1), b(2), b(4), argWork, argSlot, argEpochBuffer, argEpoch};
+
+	spec.kernels = {
+		{"cleanUp", common},
+		{"hdsHashIII_seed", seed},
+		{"hdsHashIII_R1", round},
+		{"hdsHashIII_R2", round},
+		{"hdsHashIII_R3", round},
+		{"hdsHashIII_R4", round},
+		{"hdsHashIII_R5", round},
+		{"watch_counter", common},
+
+		// Deriving the prePow on the GPU, here the work is the header that gets hashed with the nonce
+		{"hdsHashIII_prePow", {b(3), argWork, argNonce, argNonceStep, argExtraNonce, argSlot}},
+		{"hdsHashIII_seedDev", {b(0), b(1), b(2), b(4), b(3), argSlot, argEpochBuffer, argEpoch}}
+	};
+
+	vector<planStep> rounds;
+	for (uint32_t k=2; k<7; k++) rounds.push_back({k, 16384*wgSize, wgSize});	// Round 1 - 5
+
+	// The first launch seeds from the prePow of the host, the second derives it on the device first
+	// and may run several iterations
+	launchSpec host = {{{0, 5120, wgSize}, {1, 33554432, wgSize}}, false, false};
+	launchSpec device = {{{0, 5120, wgSize}, {8, 1, 1}, {9, 33554432, wgSize}}, true, true};
+	host.steps.insert(host.steps.end(), rounds.begin(), rounds.end());
+	device.steps.insert(device.steps.end(), rounds.begin(), rounds.end());
+	spec.launches = {host, device};
+
+	return spec;
 }
 
 } // End namespace hdsMiner
@@ -0,0 +1,205 @@
+// HDS OpenCL Miner
+// Solver engine, runs the pipeline of a solverSpec
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "hdsSolvers.h"
+
+namespace hdsMiner {
+
+namespace {
+	// Arguments whose value comes from the work of a launch
+	bool isWorkArg(argSource source) {
+		switch (source) {
+			case argWork:
+			case argNonce:
+			case argNonceStep:
+			case argExtraNonce:
+			case argEpoch: return true;
+			default: return false;
+		}
+	}
+}
+
+
+// Sorts the arguments of the spec once: everything fixed is bound when the buffers are created, the
+// work arguments of the kernels a launch runs are set per launch and the slot per iteration
+hdsSolver::hdsSolver(solverSpec specIn) : spec(specIn) {
+	vector<bool> launched(spec.kernels.size(), false);
+
+	for (auto &launch : spec.launches) {
+		vector<bool> inLaunch(spec.kernels.size(), false);
+		for (auto &step : launch.steps) inLaunch[step.kernel] = true;
+
+		launchArgs.emplace_back();
+		for (uint32_t k=0; k<spec.kernels.size(); k++) {
+			if (!inLaunch[k]) continue;
+			launched[k] = true;
+			for (uint32_t a=0; a<spec.kernels[k].args.size(); a++) {
+				if (isWorkArg(spec.kernels[k].args[a].source)) launchArgs.back().push_back({k, a, spec.kernels[k].args[a].source});
+			}
+		}
+	}
+
+	for (uint32_t k=0; k<spec.kernels.size(); k++) {
+		if (!launched[k]) continue;
+		for (uint32_t a=0; a<spec.kernels[k].args.size(); a++) {
+			if (spec.kernels[k].args[a].source == argSlot) slotArgs.push_back({k, a, argSlot});
+		}
+	}
+}
+
+
+cl_int hdsSolver::loadAndCompileKernel(cl::Context &context, cl::Device &device, uint32_t index) {
+
+	// Source Code of the solver
+	string progStr = string((const char*) spec.source, spec.sourceLength);
+	cl::Program::Sources source(1,std::make_pair(progStr.c_str(), progStr.length()+1));
+
+	vector<cl::Device> devicesTMP;
+	devicesTMP.push_back(device);
+
+	// Building the program for the device
+	cl::Program program(context, source);
+	cl_int err;
+	err = program.build(devicesTMP, spec.buildOptions.c_str());
+	if (err != CL_SUCCESS) return err;
+
+	// Create the Kernels
+	for (auto &k : spec.kernels) {
+		kernels[index].push_back(cl::Kernel(program, k.name.c_str(), &err));
+	}
+
+	return created(kernels[index], CL_INVALID_KERNEL_NAME);
+}
+
+
+size_t hdsSolver::allocationBytes(const bufferSpec &b) const {
+	return b.perIteration ? b.bytes * batchSize : b.bytes;
+}
+
+
+uint64_t hdsSolver::plannedBytes() const {
+	uint64_t bytes = 0;
+	for (auto &b : spec.buffers) bytes += allocationBytes(b);
+	return bytes;
+}
+
+
+uint64_t hdsSolver::largestPlannedBuffer() const {
+	uint64_t bytes = 0;
+	for (auto &b : spec.buffers) bytes = max<uint64_t>(bytes, allocationBytes(b));
+	return bytes;
+}
+
+
+cl_int hdsSolver::createBuffers(cl::Context &context, uint32_t index) {
+	cl_int err;
+
+	for (auto &b : spec.buffers) {
+		buffers[index].push_back(cl::Buffer(context, CL_MEM_READ_WRITE, allocationBytes(b), NULL, &err));
+	}
+
+	err = created(buffers[index], CL_MEM_OBJECT_ALLOCATION_FAILURE);
+	if (err == CL_SUCCESS) err = bindArguments(index);
+	return err;
+}
+
+
+// Binds all arguments that do not change with the work, the slot starts at 0. The work arguments get
+// placeholders until the first launch sets them.
+cl_int hdsSolver::bindArguments(uint32_t devInd) {
+	cl_int err = CL_SUCCESS;
+
+	for (uint32_t k=0; k<spec.kernels.size(); k++) {
+		cl::Kernel &kernel = kernels[devInd][k];
+		for (uint32_t a=0; a<spec.kernels[k].args.size(); a++) {
+			const argSpec &arg = spec.kernels[k].args[a];
+			switch (arg.source) {
+				case argBuffer:
+					check(err, kernel.setArg(a, buffers[devInd][arg.buffer]));
+					break;
+				case argEpochBuffer:
+					if (devInd >= epochBuffers.size()) return CL_INVALID_MEM_OBJECT;
+					check(err, kernel.setArg(a, epochBuffers[devInd]));
+					break;
+				case argWork:
+				case argUnusedUlong4:
+					check(err, kernel.setArg(a, cl_ulong4()));
+					break;
+				case argNonce:
+				case argNonceStep:
+					check(err, kernel.setArg(a, (cl_ulong) 0));
+					break;
+				default:
+					check(err, kernel.setArg(a, (cl_uint) 0));
+			}
+		}
+	}
+
+	boundSlot[devInd] = 0;
+	return err;
+}
+
+
+cl_int hdsSolver::setWorkArg(uint32_t devInd, const workArg &arg, const WorkDescription &wd) {
+	cl::Kernel &kernel = kernels[devInd][arg.kernel];
+	switch (arg.source) {
+		case argWork: {
+			cl_ulong4 work;
+			memcpy(&work, &(wd.work[0]), 32);
+			return kernel.setArg(arg.arg, work);
+		}
+		case argNonce: return kernel.setArg(arg.arg, (cl_ulong) wd.nonce);
+		case argNonceStep: return kernel.setArg(arg.arg, (cl_ulong) wd.nonceStep);
+		case argExtraNonce: return kernel.setArg(arg.arg, (cl_uint) wd.extraNonce);
+		case argEpoch: return kernel.setArg(arg.arg, (cl_uint) wd.epoch);
+		default: return CL_INVALID_ARG_VALUE;
+	}
+}
+
+
+uint32_t hdsSolver::selectLaunch(const WorkDescription &wd) {
+	for (uint32_t l=0; l<spec.launches.size(); l++) {
+		if (spec.launches[l].devicePrePow == wd.devicePrePow) return l;
+	}
+	return 0;
+}
+
+
+cl_int hdsSolver::queueKernels(cl::CommandQueue * queue, uint32_t devInd,  cl::Event * cbEvent, clCallbackData * workData) {
+	cl_int err = CL_SUCCESS;
+
+	uint32_t l = selectLaunch(workData->wd);
+	const launchSpec &launch = spec.launches[l];
+
+	// Several iterations per launch need the prePows derived on the device
+	uint32_t iterations = launch.batched ? min<uint32_t>(workData->wd.iterations, batchSize) : 1;
+	iterations = max<uint32_t>(iterations, 1);
+
+	for (auto &arg : launchArgs[l]) check(err, setWorkArg(devInd, arg, workData->wd));
+
+	// Arguments are copied at enqueue time, so the per iteration slot can be changed in between.
+	// The slot stays bound, a single iteration per launch never changes it.
+	for (uint32_t it=0; it < iterations; it++) {
+		if (boundSlot[devInd] != it) {
+			for (auto &arg : slotArgs) {
+				check(err, kernels[devInd][arg.kernel].setArg(arg.arg, (cl_uint) it));
+			}
+			boundSlot[devInd] = it;
+		}
+
+		for (auto &step : launch.steps) {
+			check(err, queue->enqueueNDRangeKernel(kernels[devInd][step.kernel], cl::NDRange(0), cl::NDRange(step.global), cl::NDRange(step.local), NULL, traceEvent(devInd, step.kernel)));
+		}
+	}
+
+	workData->wd.iterations = iterations;
+	cl_int mapErr;
+	results[devInd] = (uint32_t *) queue->enqueueMapBuffer(buffers[devInd][spec.resultBuffer], CL_FALSE, CL_MAP_READ, 0, sizeof(cl_uint) * resultSlotSize * iterations, NULL, cbEvent, &mapErr);	// Read the Results
+	check(err, mapErr);
+
+	return err;
+}
+
+} // End namespace hdsMiner
@@ -16,6 +16,7 @@
 #include <climits>
 
 #include "hdsUtil.h"
+#include "hdsTrace.h"
 
 using namespace std;
 
@@ -24,80 +25,230 @@ using namespace std;
 
 namespace hdsMiner {
 
+// Number of uints one iteration occupies in the results buffer:
+// [0] solution count, [1] skipped flag, [4 + 32*i] solution i (at most 10)
+const uint32_t resultSlotSize = 324;
+
+// Declarative description of a solver: program, buffers, kernels with the sources of their arguments
+// and the kernel sequence of one iteration. The engine in hdsSolver builds, allocates, binds and enqueues
+// from it, so a memory layout, a fused kernel or tuned ranges are a change of the spec, not of the engine.
+
+// Where the value of a kernel argument comes from
+enum argSource {
+	argBuffer,		// A buffer of the spec
+	argEpochBuffer,		// Oldest job epoch the device still mines on
+	argWork,		// ulong4: the header, or the prePow when the host derived it
+	argNonce,		// ulong
+	argNonceStep,		// ulong
+	argExtraNonce,		// uint
+	argEpoch,		// uint: job epoch of the work
+	argSlot,		// uint: result slot of the iteration
+	argUnusedUlong4,	// Placeholders for arguments the kernel does not read
+	argUnusedUint
+};
+
+struct argSpec {
+	argSource source;
+	uint32_t buffer;	// Index into the buffers for argBuffer
+
+	argSpec(argSource s, uint32_t b = 0) : source(s), buffer(b) {}
+};
+
+struct bufferSpec {
+	size_t bytes;
+	bool perIteration;	// Times the batch size, one part per iteration of a launch
+};
+
+struct kernelSpec {
+	string name;
+	vector<argSpec> args;
+};
+
+// One kernel of a launch with its ranges
+struct planStep {
+	uint32_t kernel;
+	size_t global;
+	size_t local;
+};
+
+// Kernel sequence of one iteration
+struct launchSpec {
+	vector<planStep> steps;
+	bool devicePrePow;	// Taken for work with the prePow derived on the device
+	bool batched;		// Several iterations per launch, each with its own result slot
+};
+
+struct solverSpec {
+	const unsigned char * source;
+	size_t sourceLength;
+	string buildOptions;
+	vector<bufferSpec> buffers;
+	vector<kernelSpec> kernels;
+	vector<launchSpec> launches;	// The first one is taken when no other fits
+	uint32_t resultBuffer;		// Holds resultSlotSize uints for each iteration
+};
+
+solverSpec hdsHashISpec();
+solverSpec hdsHashIISpec();
+solverSpec hdsHashIIISpec();
+
+// Device timestamps of one kernel in ns, taken from its profiling event
+struct kernelTiming {
+	string name;
+	cl_ulong queued;
+	cl_ulong start;
+	cl_ulong end;
+};
+
 class hdsSolver {
 	protected:
+	solverSpec spec;
+
 	// OpenCL 
 	vector< vector<cl::Buffer> > buffers;
 	vector< vector<cl::Kernel> > kernels;
 
 	vector< uint32_t* > results;
 
+	// Device visible oldest job epoch still mined, written by the host when a new job arrives
+	vector<cl::Buffer> epochBuffers;
+
+	// Arguments that change with the work, for each launch of the spec only the ones of its kernels.
+	// All others stay bound from the allocation of the buffers on.
+	struct workArg {
+		uint32_t kernel;
+		uint32_t arg;
+		argSource source;
+	};
+	vector< vector<workArg> > launchArgs;
+	vector<workArg> slotArgs;
+	vector<uint32_t> boundSlot;	// Result slot the kernels of a device are bound to
+
+	// Number of iterations one launch may contain
+	uint32_t batchSize = 1;
+
+	// Profiling events of the kernels of the running launch with their kernel index, only while tracing
+	vector< vector< pair<uint32_t, cl::Event> > > kernelEvents;
+
+	cl::Event * traceEvent(uint32_t gpu, uint32_t kernel) {
+		if (!traceEnabled()) return NULL;
+		kernelEvents[gpu].emplace_back(kernel, cl::Event());
+		return &kernelEvents[gpu].back().second;
+	}
+
+	// Keeps the first failing status of a sequence of OpenCL calls
+	static void check(cl_int &status, cl_int err) {
+		if (status == CL_SUCCESS) status = err;
+	}
+
+	// Constructors report through an out parameter, a failed one leaves a null object behind
+	template <typename T> static cl_int created(vector<T> &objects, cl_int failure) {
+		for (auto &o : objects) {
+			if (o() == NULL) return failure;
+		}
+		return CL_SUCCESS;
+	}
+
 	// Functions
-	virtual void loadAndCompileKernel(cl::Context &, cl::Device &, uint32_t) = 0;
+	cl_int loadAndCompileKernel(cl::Context &, cl::Device &, uint32_t);
+	cl_int bindArguments(uint32_t);
+	cl_int setWorkArg(uint32_t, const workArg &, const WorkDescription &);
+	uint32_t selectLaunch(const WorkDescription &);
+	size_t allocationBytes(const bufferSpec &) const;
 	
 	public:
+	hdsSolver(solverSpec);
 	
-	// Setup function for the PoW scheme
-	void setup(vector<cl::Device> &devices, vector<cl::Context> &contexts, vector<uint32_t> &contextMap) {
+	// Setup function for the PoW scheme, with the context of each device. A device whose
+	// kernels failed to build has none and is reset by the host once it tries to start it.
+	void setup(vector<cl::Device> &devices, vector<cl::Context> &contexts) {
 		buffers.resize(devices.size());
 		kernels.resize(devices.size());
 		results.resize(devices.size());
+		kernelEvents.resize(devices.size());
+		boundSlot.resize(devices.size());
 
 		for (uint32_t i=0; i<devices.size(); i++) {
-			loadAndCompileKernel(contexts[contextMap[i]], devices[i], i);
+			if (loadAndCompileKernel(contexts[i], devices[i], i) != CL_SUCCESS) kernels[i].clear();
 		}
 	}
 
+	void setEpochBuffers(vector<cl::Buffer> &epochIn) {
+		epochBuffers = epochIn;
+	}
+
+	// Drops everything of one device and compiles the kernels again, used after the device was reset
+	cl_int rebuild(cl::Context &context, cl::Device &device, uint32_t gpu, cl::Buffer &epochBuffer) {
+		stop(gpu);
+		kernelEvents[gpu].clear();
+		if (gpu < epochBuffers.size()) epochBuffers[gpu] = epochBuffer;
+		cl_int err = loadAndCompileKernel(context, device, gpu);
+		if (err != CL_SUCCESS) kernels[gpu].clear();
+		return err;
+	}
+
+	void setBatchSize(uint32_t size) {
+		batchSize = max<uint32_t>(size, 1);
+	}
+
 	// Destructor to free memory
 	void stop(uint32_t gpu) {
-		buffers[gpu].clear();
+		releaseBuffers(gpu);
 		kernels[gpu].clear();
 	}
 
-	uint32_t * getResults(uint32_t gpu) {
-		return results[gpu];
+	// Frees the device memory but keeps the compiled kernels for a later switch back
+	void releaseBuffers(uint32_t gpu) {
+		buffers[gpu].clear();
 	}
 
-	virtual void createBuffers(cl::Context &, cl::Device &, uint32_t) = 0;
-	virtual void queueKernels(cl::CommandQueue *, uint32_t,  cl::Event *, clCallbackData *) = 0;
-	
-	void unmapResult(cl::CommandQueue * queue, uint32_t gpu) {
-		queue->enqueueUnmapMemObject(buffers[gpu][buffers[gpu].size() - 1], results[gpu], NULL, NULL);
-	}
-};
+	// Device memory createBuffers will allocate at the current batch size, in total and for its largest buffer
+	uint64_t plannedBytes() const;
+	uint64_t largestPlannedBuffer() const;
 
-class hdsHashI_S : public hdsSolver {
-	private:
-	void loadAndCompileKernel(cl::Context &, cl::Device &, uint32_t);
+	// Device memory the buffers of one device occupy
+	uint64_t bufferBytes(uint32_t gpu) {
+		uint64_t bytes = 0;
+		for (auto &b : buffers[gpu]) bytes += b.getInfo<CL_MEM_SIZE>();
+		return bytes;
+	}
 
-	public:
-	void createBuffers(cl::Context &, cl::Device &, uint32_t);
-	void queueKernels(cl::CommandQueue *, uint32_t,  cl::Event *, clCallbackData *);
-	void unmapResult(uint32_t);
-};
+	bool hasBuffers(uint32_t gpu) {
+		return (buffers[gpu].size() > 0);
+	}
 
-class hdsHashII_S : public hdsSolver {
-	private:
-	void loadAndCompileKernel(cl::Context &, cl::Device &, uint32_t);
+	bool hasKernels(uint32_t gpu) {
+		return (kernels[gpu].size() > 0);
+	}
 
-	public:
-	void createBuffers(cl::Context &, cl::Device &, uint32_t);
-	void queueKernels(cl::CommandQueue *, uint32_t,  cl::Event *, clCallbackData *);
-	void unmapResult(uint32_t);
-};
+	// Timings of the kernels of the finished launch, needs a queue with profiling enabled
+	vector<kernelTiming> takeKernelTimings(uint32_t gpu) {
+		vector<kernelTiming> timings;
+		for (auto &ev : kernelEvents[gpu]) {
+			kernelTiming t;
+			t.name = (ev.first < kernels[gpu].size()) ? kernels[gpu][ev.first].getInfo<CL_KERNEL_FUNCTION_NAME>() : "kernel";
+			if (ev.second.getProfilingInfo(CL_PROFILING_COMMAND_QUEUED, &t.queued) != CL_SUCCESS) continue;
+			ev.second.getProfilingInfo(CL_PROFILING_COMMAND_START, &t.start);
+			ev.second.getProfilingInfo(CL_PROFILING_COMMAND_END, &t.end);
+			timings.push_back(t);
+		}
+		kernelEvents[gpu].clear();
+		return timings;
+	}
 
-class hdsHashIII_S : public hdsSolver {
-	private:
-	void loadAndCompileKernel(cl::Context &, cl::Device &, uint32_t);
+	uint32_t * getResults(uint32_t gpu) {
+		return results[gpu];
+	}
 
-	public:
-	void createBuffers(cl::Context &, cl::Device &, uint32_t);
-	void queueKernels(cl::CommandQueue *, uint32_t,  cl::Event *, clCallbackData *);
-	void unmapResult(uint32_t);
+	// Both return the first OpenCL error, CL_SUCCESS otherwise
+	cl_int createBuffers(cl::Context &, uint32_t);
+	cl_int queueKernels(cl::CommandQueue *, uint32_t,  cl::Event *, clCallbackData *);
+	
+	void unmapResult(cl::CommandQueue * queue, uint32_t gpu) {
+		queue->enqueueUnmapMemObject(buffers[gpu][spec.resultBuffer], results[gpu], NULL, NULL);
+	}
 };
 
-
-
 }
 
 #endif
@@ -1,4 +1,19 @@
 #define bucketSize 8720 
+#define resultSlot 324		// uints per iteration in the results buffer
+#define maxSols 10
+
+/*
+	Work groups of the rounds end right away once their job is older than the oldest one the
+	host still takes solutions for. One work item reads the epoch, so the whole group takes the same path.
+*/
+#define skipOnNewJob(lId) 				\
+    __local uint staleJob[1]; 				\
+    if (lId == 0) staleJob[0] = (epoch < jobEpoch[0]); 	\
+    barrier(CLK_LOCAL_MEM_FENCE); 			\
+    if (staleJob[0]) { 					\
+        if (lId == 0) results[slot*resultSlot + 1] = 1; 	\
+        return; 					\
+    }
 
 #ifndef wgSize 
 #define wgSize 256
@@ -70,26 +85,120 @@ __kernel void cleanUp(	__global ulong8 * buffer0,
 			__global ulong8 * buffer1,
 			__global uint4 * counters,
 			__global uint * results,
-			ulong4 prePow) {
+			ulong4 prePow,
+			uint slot,
+			__global volatile uint * jobEpoch,
+			uint epoch) {
 
 	uint gId = get_global_id(0);
 	counters[gId] = (uint4) 0;
 
 	if (get_global_id(0) == 0) {
-		results[0] = 0;
+		results[slot*resultSlot + 0] = 0;	// Number of solutions
+		results[slot*resultSlot + 1] = 0;	// Iteration skipped due to a new job
 	}
 }
 
 /*
-	Kernel for round 0 (seed)
-	Writing to buffer0
+	Blake2b as used for the prePow: 32 byte output, personalization "Hds--PoW",
+	n = 448 and k = 5, one final block of 44 bytes (work || nonce || extraNonce)
 */
-__attribute__((reqd_work_group_size(wgSize, 1, 1)))
-__kernel void hdsHashIII_seed (__global ulong8 * buffer0,
-				__global ulong8 * buffer1,
-				__global uint * counters,
-				__global uint * results,
-				ulong4 prePow) {
+__constant ulong blake_iv[] =
+{
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b,
+    0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+    0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+    0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+};
+
+__constant uchar blake_sigma[12][16] = {
+      {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+      { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+      { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+      {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+      {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+      {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+      { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+      { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+      {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+      { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+      {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+      { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }};
+
+#define blakeG(va, vb, vc, vd, x, y) 		\
+    va = va + vb + x; 				\
+    vd = rotate(vd ^ va, 32UL); 		\
+    vc = vc + vd; 				\
+    vb = rotate(vb ^ vc, 40UL); 		\
+    va = va + vb + y; 				\
+    vd = rotate(vd ^ va, 48UL); 		\
+    vc = vc + vd; 				\
+    vb = rotate(vb ^ vc, 1UL);
+
+inline ulong4 blakePrePow(ulong4 header, ulong nonce, uint extraNonce) {
+	ulong m[16];
+	ulong v[16];
+
+	m[0] = header.s0;
+	m[1] = header.s1;
+	m[2] = header.s2;
+	m[3] = header.s3;
+	m[4] = nonce;
+	m[5] = (ulong) extraNonce;
+	for (uint i=6; i<16; i++) m[i] = 0;
+
+	ulong h[8];
+	h[0] = blake_iv[0] ^ (0x01010000 | 32);
+	h[1] = blake_iv[1];
+	h[2] = blake_iv[2];
+	h[3] = blake_iv[3];
+	h[4] = blake_iv[4];
+	h[5] = blake_iv[5];
+	h[6] = blake_iv[6] ^ 0x576F502D2D736448;	// Equals personalization string "Hds--PoW"
+	h[7] = blake_iv[7] ^ ((5UL << 32) | 448);	// k and n
+
+	for (uint i=0; i<8; i++) {
+		v[i] = h[i];
+		v[i+8] = blake_iv[i];
+	}
+
+	v[12] ^= 44;		// 32 byte work + 8 byte nonce + 4 byte extra nonce
+	v[14] ^= (ulong) -1;	// final block
+
+	for (uint r=0; r<12; r++) {
+		blakeG(v[0], v[4], v[8],  v[12], m[blake_sigma[r][0]],  m[blake_sigma[r][1]]);
+		blakeG(v[1], v[5], v[9],  v[13], m[blake_sigma[r][2]],  m[blake_sigma[r][3]]);
+		blakeG(v[2], v[6], v[10], v[14], m[blake_sigma[r][4]],  m[blake_sigma[r][5]]);
+		blakeG(v[3], v[7], v[11], v[15], m[blake_sigma[r][6]],  m[blake_sigma[r][7]]);
+		blakeG(v[0], v[5], v[10], v[15], m[blake_sigma[r][8]],  m[blake_sigma[r][9]]);
+		blakeG(v[1], v[6], v[11], v[12], m[blake_sigma[r][10]], m[blake_sigma[r][11]]);
+		blakeG(v[2], v[7], v[8],  v[13], m[blake_sigma[r][12]], m[blake_sigma[r][13]]);
+		blakeG(v[3], v[4], v[9],  v[14], m[blake_sigma[r][14]], m[blake_sigma[r][15]]);
+	}
+
+	return (ulong4) (h[0] ^ v[0] ^ v[8], h[1] ^ v[1] ^ v[9], h[2] ^ v[2] ^ v[10], h[3] ^ v[3] ^ v[11]);
+}
+
+/*
+	Kernel deriving the prePow of one iteration on the device
+	Writing to prePows[iteration]
+*/
+__kernel void hdsHashIII_prePow (__global ulong4 * prePows,
+				ulong4 header,
+				ulong nonce,
+				ulong nonceStep,
+				uint extraNonce,
+				uint iteration) {
+
+	if (get_global_id(0) == 0) {
+		prePows[iteration] = blakePrePow(header, nonce + iteration * nonceStep, extraNonce);
+	}
+}
+
+/*
+	Round 0 (seed) for one work item
+*/
+inline void seedElement(ulong4 prePow, __global ulong8 * buffer0, __global uint * counters) {
 
 	uint gId = get_global_id(0);
 
@@ -117,8 +226,51 @@ __kernel void hdsHashIII_seed (__global ulong8 * buffer0,
 	pos += bucket * bucketSize;
 
 	buffer0[pos] = elem;	
+}
 
+/*
+	Kernel for round 0 (seed)
+	Writing to buffer0
+*/
+__attribute__((reqd_work_group_size(wgSize, 1, 1)))
+__kernel void hdsHashIII_seed (__global ulong8 * buffer0,
+				__global ulong8 * buffer1,
+				__global uint * counters,
+				__global uint * results,
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
+
+	if (epoch < jobEpoch[0]) {
+		results[slot*resultSlot + 1] = 1;
+		return;
+	}
+
+	seedElement(prePow, buffer0, counters);
+}
+
+/*
+	Kernel for round 0 (seed) with the prePow derived on the device
+	Writing to buffer0
+	When the host published a new job the iteration is skipped
+*/
+__attribute__((reqd_work_group_size(wgSize, 1, 1)))
+__kernel void hdsHashIII_seedDev (__global ulong8 * buffer0,
+				__global ulong8 * buffer1,
+				__global uint * counters,
+				__global uint * results,
+				__global ulong4 * prePows,
+				uint iteration,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
+
+	if (epoch < jobEpoch[0]) {
+		results[iteration*resultSlot + 1] = 1;
+		return;
+	}
 
+	seedElement(prePows[iteration], buffer0, counters);
 }
 
 /*
@@ -131,12 +283,17 @@ __kernel void hdsHashIII_R1 (	__global ulong8 * buffer0,
 				__global ulong8 * buffer1,
 				__global uint * counters,
 				__global uint * results,
-				ulong4 prePow) {
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
 
 	uint bucket  = get_group_id(0);
 	uint locSize = get_local_size(0);
 	uint lId     = get_local_id(0);
 
+	skipOnNewJob(lId);
+
 	uint mask  = bucket & 0x3;
 	bucket     = bucket >> 2;
 
@@ -224,12 +381,17 @@ __kernel void hdsHashIII_R2 (	__global ulong8 * buffer0,
 				__global ulong8 * buffer1,
 				__global uint * counters,
 				__global uint * results,
-				ulong4 prePow) {
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
 
 	uint bucket  = get_group_id(0);
 	uint locSize = get_local_size(0);
 	uint lId     = get_local_id(0);
 
+	skipOnNewJob(lId);
+
 	uint mask  = bucket & 0x3;
 	bucket     = bucket >> 2;
 
@@ -327,12 +489,17 @@ __kernel void hdsHashIII_R3 (	__global ulong8 * buffer0,
 				__global ulong8 * buffer1,
 				__global uint * counters,
 				__global uint * results,
-				ulong4 prePow) {
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
 
 	uint bucket  = get_group_id(0);
 	uint locSize = get_local_size(0);
 	uint lId     = get_local_id(0);
 
+	skipOnNewJob(lId);
+
 	uint mask  = bucket & 0x3;
 	bucket     = bucket >> 2;
 
@@ -443,12 +610,17 @@ __kernel void hdsHashIII_R4 (	__global ulong8 * buffer0,
 				__global ulong8 * buffer1,
 				__global uint * counters,
 				__global uint * results,
-				ulong4 prePow) {
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
 
 	uint bucket  = get_group_id(0);
 	uint locSize = get_local_size(0);
 	uint lId     = get_local_id(0);
 
+	skipOnNewJob(lId);
+
 	uint mask  = bucket & 0x3;
 	bucket     = bucket >> 2;
 
@@ -563,12 +735,17 @@ __kernel void hdsHashIII_R5 (	__global ulong8 * buffer0,
 				__global ulong8 * buffer1,
 				__global uint * counters,
 				__global uint * results,
-				ulong4 prePow) {
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
 
 	uint bucket  = get_group_id(0);
 	uint locSize = get_local_size(0);
 	uint lId     = get_local_id(0);
 
+	skipOnNewJob(lId);
+
 	uint mask  = bucket & 0x3;
 	bucket     = bucket >> 2;
 
@@ -579,6 +756,7 @@ __kernel void hdsHashIII_R5 (	__global ulong8 * buffer0,
 	__local uint table[2560];
 	__local uint inCounter[1];
 
+	results = &results[slot*resultSlot];
 	__global ulong2 * resultsUL = (__global ulong2 *) results;
 
 	for (uint i=lId; i<1024; i+=locSize) {
@@ -623,6 +801,7 @@ __kernel void hdsHashIII_R5 (	__global ulong8 * buffer0,
 
 				// We have a solution!
 				uint pos = atomic_inc(&results[0]);
+				if (pos >= maxSols) continue;	// Do not overwrite the next slot
 
 				stepRow0 = shift56(stepRow0);
 				stepRow1 = shift56(stepRow1);
@@ -655,7 +834,10 @@ __kernel void watch_counter    (__global ulong8 * buffer0,
 				__global ulong8 * buffer1,
 				__global uint * counters,
 				__global uint * results,
-				ulong4 prePow) {
+				ulong4 prePow,
+				uint slot,
+				__global volatile uint * jobEpoch,
+				uint epoch) {
 
 	if (get_global_id(0) == 0) {
 		uint sum=0;
@@ -1,237 +1,668 @@
 unsigned char __hds_hash_III_cl[] = {
   0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x62, 0x75, 0x63, 0x6b,
   0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x38, 0x37, 0x32, 0x30, 0x20,
-  0x0a, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x77, 0x67,
-  0x53, 0x69, 0x7a, 0x65, 0x20, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
-  0x65, 0x20, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x32, 0x35, 0x36,
-  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x23, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x49, 0x50, 0x52, 0x4f, 0x55, 0x4e,
-  0x44, 0x20, 0x09, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x76, 0x30, 0x20, 0x2b, 0x3d, 0x20, 0x76, 0x31, 0x3b, 0x20, 0x76, 0x32,
-  0x20, 0x2b, 0x3d, 0x20, 0x76, 0x33, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x31, 0x20, 0x3d, 0x20, 0x72, 0x6f,
-  0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x31, 0x2c, 0x20, 0x31, 0x33, 0x55,
-  0x4c, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x76, 0x33, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65,
-  0x28, 0x76, 0x33, 0x2c, 0x20, 0x31, 0x36, 0x55, 0x4c, 0x29, 0x3b, 0x20,
-  0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x31, 0x20,
-  0x5e, 0x3d, 0x20, 0x76, 0x30, 0x3b, 0x20, 0x76, 0x33, 0x20, 0x5e, 0x3d,
-  0x20, 0x76, 0x32, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26,
-  0x76, 0x30, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75,
-  0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x30, 0x29, 0x5b, 0x30,
-  0x5d, 0x2e, 0x79, 0x78, 0x3b, 0x20, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x76, 0x32, 0x20, 0x2b, 0x3d, 0x20, 0x76, 0x31, 0x3b, 0x20, 0x76,
-  0x30, 0x20, 0x2b, 0x3d, 0x20, 0x76, 0x33, 0x3b, 0x20, 0x09, 0x09, 0x09,
-  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x31, 0x20, 0x3d, 0x20, 0x72,
-  0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x31, 0x2c, 0x20, 0x31, 0x37,
-  0x55, 0x4c, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x76, 0x33, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x76, 0x33, 0x2c, 0x20, 0x32, 0x31, 0x55, 0x4c, 0x29, 0x3b,
-  0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x31,
-  0x20, 0x5e, 0x3d, 0x20, 0x76, 0x32, 0x3b, 0x20, 0x76, 0x33, 0x20, 0x5e,
-  0x3d, 0x20, 0x76, 0x30, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29,
-  0x26, 0x76, 0x32, 0x29, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x28,
-  0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x32, 0x29, 0x5b,
-  0x30, 0x5d, 0x2e, 0x79, 0x78, 0x3b, 0x20, 0x0a, 0x0a, 0x69, 0x6e, 0x6c,
-  0x69, 0x6e, 0x65, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69,
-  0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x75,
-  0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x30, 0x20,
-  0x3d, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73, 0x30, 0x2c,
-  0x20, 0x76, 0x31, 0x20, 0x3d, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
-  0x2e, 0x73, 0x31, 0x2c, 0x20, 0x76, 0x32, 0x20, 0x3d, 0x20, 0x70, 0x72,
-  0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73, 0x32, 0x2c, 0x20, 0x76, 0x33, 0x20,
-  0x3d, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73, 0x33, 0x20,
-  0x5e, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x09, 0x0a, 0x09,
-  0x53, 0x49, 0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x20, 0x53, 0x49,
-  0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x0a, 0x09, 0x76, 0x30, 0x20,
-  0x5e, 0x3d, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x09, 0x76,
-  0x32, 0x20, 0x5e, 0x3d, 0x20, 0x30, 0x78, 0x66, 0x66, 0x3b, 0x0a, 0x09,
-  0x53, 0x49, 0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x20, 0x53, 0x49,
-  0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x20, 0x53, 0x49, 0x50, 0x52,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x72, 0x65, 0x73,
+  0x75, 0x6c, 0x74, 0x53, 0x6c, 0x6f, 0x74, 0x20, 0x33, 0x32, 0x34, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x70, 0x65,
+  0x72, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x73, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x6d, 0x61, 0x78, 0x53, 0x6f, 0x6c,
+  0x73, 0x20, 0x31, 0x30, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x57, 0x6f,
+  0x72, 0x6b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20,
+  0x65, 0x6e, 0x64, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x61, 0x77,
+  0x61, 0x79, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x69,
+  0x72, 0x20, 0x6a, 0x6f, 0x62, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x6c, 0x64,
+  0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6f, 0x6c, 0x64, 0x65, 0x73, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x74,
+  0x68, 0x65, 0x0a, 0x09, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x73, 0x74, 0x69,
+  0x6c, 0x6c, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x73, 0x6f, 0x6c,
+  0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x2e, 0x20,
+  0x4f, 0x6e, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x69, 0x74, 0x65,
+  0x6d, 0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x65, 0x70, 0x6f, 0x63, 0x68, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x73, 0x61, 0x6d, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2e, 0x0a, 0x2a,
+  0x2f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x73, 0x6b,
+  0x69, 0x70, 0x4f, 0x6e, 0x4e, 0x65, 0x77, 0x4a, 0x6f, 0x62, 0x28, 0x6c,
+  0x49, 0x64, 0x29, 0x20, 0x09, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x6c, 0x65, 0x4a, 0x6f, 0x62, 0x5b,
+  0x31, 0x5d, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d,
+  0x20, 0x30, 0x29, 0x20, 0x73, 0x74, 0x61, 0x6c, 0x65, 0x4a, 0x6f, 0x62,
+  0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x65, 0x70, 0x6f, 0x63, 0x68,
+  0x20, 0x3c, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x5b,
+  0x30, 0x5d, 0x29, 0x3b, 0x20, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x61, 0x6c, 0x65,
+  0x4a, 0x6f, 0x62, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x7b, 0x20, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x49, 0x64, 0x20, 0x3d, 0x3d, 0x20,
+  0x30, 0x29, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x73,
+  0x6c, 0x6f, 0x74, 0x2a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x53, 0x6c,
+  0x6f, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x31, 0x3b,
+  0x20, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x23, 0x69,
+  0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65,
+  0x20, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x77, 0x67,
+  0x53, 0x69, 0x7a, 0x65, 0x20, 0x32, 0x35, 0x36, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x0a, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x53, 0x49, 0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x20, 0x09, 0x09,
+  0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x30, 0x20, 0x2b,
+  0x3d, 0x20, 0x76, 0x31, 0x3b, 0x20, 0x76, 0x32, 0x20, 0x2b, 0x3d, 0x20,
+  0x76, 0x33, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x76, 0x31, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65,
+  0x28, 0x76, 0x31, 0x2c, 0x20, 0x31, 0x33, 0x55, 0x4c, 0x29, 0x3b, 0x20,
+  0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x33, 0x20,
+  0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x33, 0x2c,
+  0x20, 0x31, 0x36, 0x55, 0x4c, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x31, 0x20, 0x5e, 0x3d, 0x20, 0x76,
+  0x30, 0x3b, 0x20, 0x76, 0x33, 0x20, 0x5e, 0x3d, 0x20, 0x76, 0x32, 0x3b,
+  0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28,
+  0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x30, 0x29, 0x5b,
+  0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32,
+  0x2a, 0x29, 0x26, 0x76, 0x30, 0x29, 0x5b, 0x30, 0x5d, 0x2e, 0x79, 0x78,
+  0x3b, 0x20, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x32, 0x20,
+  0x2b, 0x3d, 0x20, 0x76, 0x31, 0x3b, 0x20, 0x76, 0x30, 0x20, 0x2b, 0x3d,
+  0x20, 0x76, 0x33, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x76, 0x31, 0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74,
+  0x65, 0x28, 0x76, 0x31, 0x2c, 0x20, 0x31, 0x37, 0x55, 0x4c, 0x29, 0x3b,
+  0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x33,
+  0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x33,
+  0x2c, 0x20, 0x32, 0x31, 0x55, 0x4c, 0x29, 0x3b, 0x20, 0x09, 0x09, 0x09,
+  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x31, 0x20, 0x5e, 0x3d, 0x20,
+  0x76, 0x32, 0x3b, 0x20, 0x76, 0x33, 0x20, 0x5e, 0x3d, 0x20, 0x76, 0x30,
+  0x3b, 0x20, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x2a, 0x29, 0x26, 0x76, 0x32, 0x29,
+  0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x32, 0x2a, 0x29, 0x26, 0x76, 0x32, 0x29, 0x5b, 0x30, 0x5d, 0x2e, 0x79,
+  0x78, 0x3b, 0x20, 0x0a, 0x0a, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61, 0x73,
+  0x68, 0x32, 0x34, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70,
+  0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x30, 0x20, 0x3d, 0x20, 0x70, 0x72,
+  0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73, 0x30, 0x2c, 0x20, 0x76, 0x31, 0x20,
+  0x3d, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73, 0x31, 0x2c,
+  0x20, 0x76, 0x32, 0x20, 0x3d, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
+  0x2e, 0x73, 0x32, 0x2c, 0x20, 0x76, 0x33, 0x20, 0x3d, 0x20, 0x70, 0x72,
+  0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73, 0x33, 0x20, 0x5e, 0x20, 0x6e, 0x6f,
+  0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x53, 0x49, 0x50, 0x52,
   0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x20, 0x53, 0x49, 0x50, 0x52, 0x4f, 0x55,
-  0x4e, 0x44, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
-  0x28, 0x76, 0x30, 0x20, 0x5e, 0x20, 0x76, 0x31, 0x20, 0x5e, 0x20, 0x76,
-  0x32, 0x20, 0x20, 0x5e, 0x20, 0x76, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
-  0x0a, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x72, 0x20, 0x28, 0x75, 0x6c, 0x6f,
-  0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x73, 0x75,
-  0x6c, 0x74, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
-  0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x2c, 0x20, 0x32, 0x39, 0x55, 0x4c,
-  0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b,
-  0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70,
-  0x75, 0x74, 0x2e, 0x73, 0x31, 0x2c, 0x20, 0x35, 0x38, 0x55, 0x4c, 0x29,
-  0x3b, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d,
-  0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75,
-  0x74, 0x2e, 0x73, 0x32, 0x2c, 0x20, 0x32, 0x33, 0x55, 0x4c, 0x29, 0x3b,
-  0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20,
-  0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x2e, 0x73, 0x33, 0x2c, 0x20, 0x35, 0x32, 0x55, 0x4c, 0x29, 0x3b, 0x0a,
-  0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72,
+  0x4e, 0x44, 0x3b, 0x0a, 0x09, 0x76, 0x30, 0x20, 0x5e, 0x3d, 0x20, 0x6e,
+  0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x09, 0x76, 0x32, 0x20, 0x5e, 0x3d,
+  0x20, 0x30, 0x78, 0x66, 0x66, 0x3b, 0x0a, 0x09, 0x53, 0x49, 0x50, 0x52,
+  0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x20, 0x53, 0x49, 0x50, 0x52, 0x4f, 0x55,
+  0x4e, 0x44, 0x3b, 0x20, 0x53, 0x49, 0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44,
+  0x3b, 0x20, 0x53, 0x49, 0x50, 0x52, 0x4f, 0x55, 0x4e, 0x44, 0x3b, 0x0a,
+  0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x76, 0x30, 0x20,
+  0x5e, 0x20, 0x76, 0x31, 0x20, 0x5e, 0x20, 0x76, 0x32, 0x20, 0x20, 0x5e,
+  0x20, 0x76, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x69, 0x6e, 0x6c,
+  0x69, 0x6e, 0x65, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x69,
+  0x78, 0x65, 0x72, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x6c,
+  0x6f, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x3b, 0x0a,
+  0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x72,
   0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x34, 0x2c, 0x20, 0x31, 0x37, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09,
+  0x73, 0x30, 0x2c, 0x20, 0x32, 0x39, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09,
   0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f,
   0x74, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73,
-  0x35, 0x2c, 0x20, 0x34, 0x36, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72,
+  0x31, 0x2c, 0x20, 0x35, 0x38, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72,
   0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f, 0x74,
-  0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x36,
-  0x2c, 0x20, 0x31, 0x31, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x32,
+  0x2c, 0x20, 0x32, 0x33, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65,
   0x73, 0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61,
-  0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x37, 0x2c,
-  0x20, 0x34, 0x30, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28,
-  0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2c, 0x20, 0x32, 0x34, 0x55, 0x4c,
-  0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x0a, 0x0a, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
-  0x38, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x32, 0x34, 0x28, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x74, 0x6d,
-  0x70, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3e,
-  0x3e, 0x20, 0x32, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x38, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x34, 0x30, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33,
-  0x20, 0x7c, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x32,
-  0x33, 0x34, 0x3b, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x34, 0x35,
-  0x36, 0x20, 0x7c, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x35,
-  0x36, 0x37, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x75, 0x6c, 0x6f,
-  0x6e, 0x67, 0x38, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x35, 0x36, 0x28,
-  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
-  0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
-  0x20, 0x3e, 0x3e, 0x20, 0x35, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x38, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x20, 0x3d, 0x20,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29,
-  0x3b, 0x0a, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x31, 0x32,
-  0x33, 0x20, 0x7c, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31,
-  0x32, 0x33, 0x34, 0x3b, 0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x34,
-  0x35, 0x36, 0x20, 0x7c, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73,
-  0x35, 0x36, 0x37, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x20, 0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x2f,
-  0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x43, 0x6c,
-  0x65, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x2a, 0x2f, 0x0a, 0x5f,
-  0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f,
-  0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f,
-  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77,
-  0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29,
-  0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20,
-  0x76, 0x6f, 0x69, 0x64, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x55, 0x70,
-  0x28, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66,
-  0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
-  0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09,
-  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x34, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
-  0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09,
-  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f,
-  0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x67, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x67, 0x49,
-  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x29,
-  0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x67, 0x65,
-  0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28,
-  0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09,
-  0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20,
-  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f,
-  0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30, 0x20, 0x28, 0x73,
-  0x65, 0x65, 0x64, 0x29, 0x0a, 0x09, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6e,
-  0x67, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
-  0x0a, 0x2a, 0x2f, 0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
-  0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f,
-  0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73,
-  0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20,
-  0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65,
-  0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65,
-  0x61, 0x6d, 0x48, 0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x73, 0x65,
-  0x65, 0x64, 0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x74, 0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x33, 0x2c,
+  0x20, 0x35, 0x32, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x73,
+  0x75, 0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74,
+  0x65, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x34, 0x2c, 0x20,
+  0x31, 0x37, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65,
+  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x35, 0x2c, 0x20, 0x34,
+  0x36, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x36, 0x2c, 0x20, 0x31, 0x31,
+  0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x20, 0x2b, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x37, 0x2c, 0x20, 0x34, 0x30, 0x55,
+  0x4c, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x2c, 0x20, 0x32, 0x34, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x7d,
+  0x20, 0x0a, 0x0a, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x68,
+  0x69, 0x66, 0x74, 0x32, 0x34, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20,
+  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x34,
+  0x29, 0x3b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x74,
+  0x6d, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x3c, 0x3c, 0x20, 0x34, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x74,
+  0x6d, 0x70, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33, 0x20, 0x7c, 0x3d, 0x20,
+  0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x32, 0x33, 0x34, 0x3b, 0x0a,
+  0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x34, 0x35, 0x36, 0x20, 0x7c, 0x3d,
+  0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x35, 0x36, 0x37, 0x3b, 0x0a,
+  0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6d, 0x70,
+  0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
+  0x73, 0x68, 0x69, 0x66, 0x74, 0x35, 0x36, 0x28, 0x75, 0x6c, 0x6f, 0x6e,
+  0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x74, 0x6d, 0x70, 0x20,
+  0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3e, 0x3e, 0x20,
+  0x35, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38,
+  0x20, 0x74, 0x6d, 0x70, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
+  0x74, 0x6d, 0x70, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33, 0x20, 0x7c, 0x3d,
+  0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x31, 0x32, 0x33, 0x34, 0x3b,
+  0x0a, 0x09, 0x74, 0x6d, 0x70, 0x2e, 0x73, 0x34, 0x35, 0x36, 0x20, 0x7c,
+  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x32, 0x2e, 0x73, 0x35, 0x36, 0x37, 0x3b,
+  0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x6d,
+  0x70, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b,
+  0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x43, 0x6c, 0x65, 0x61, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x0a, 0x2a, 0x2f, 0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65,
+  0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a,
+  0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f,
+  0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x63, 0x6c, 0x65, 0x61, 0x6e, 0x55, 0x70, 0x28, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c,
+  0x0a, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
   0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75,
-  0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f,
-  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31,
-  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c,
+  0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34,
+  0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c,
+  0x0a, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e,
+  0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x0a, 0x09,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c,
+  0x0a, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63,
+  0x68, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65,
+  0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x67, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
+  0x5b, 0x67, 0x49, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x34, 0x29, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f,
+  0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b,
+  0x73, 0x6c, 0x6f, 0x74, 0x2a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x53,
+  0x6c, 0x6f, 0x74, 0x20, 0x2b, 0x20, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30,
+  0x3b, 0x09, 0x2f, 0x2f, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x0a, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x73,
+  0x6c, 0x6f, 0x74, 0x2a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x53, 0x6c,
+  0x6f, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x09, 0x2f, 0x2f, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x70, 0x65, 0x64, 0x20, 0x64, 0x75,
+  0x65, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x6a,
+  0x6f, 0x62, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a,
+  0x09, 0x42, 0x6c, 0x61, 0x6b, 0x65, 0x32, 0x62, 0x20, 0x61, 0x73, 0x20,
+  0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x3a, 0x20, 0x33, 0x32, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c,
+  0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x61, 0x6c, 0x69, 0x7a, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x22, 0x48, 0x64, 0x73, 0x2d, 0x2d, 0x50,
+  0x6f, 0x57, 0x22, 0x2c, 0x0a, 0x09, 0x6e, 0x20, 0x3d, 0x20, 0x34, 0x34,
+  0x38, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6b, 0x20, 0x3d, 0x20, 0x35, 0x2c,
+  0x20, 0x6f, 0x6e, 0x65, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x34, 0x34, 0x20, 0x62,
+  0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x7c,
+  0x7c, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x7c, 0x7c, 0x20, 0x65,
+  0x78, 0x74, 0x72, 0x61, 0x4e, 0x6f, 0x6e, 0x63, 0x65, 0x29, 0x0a, 0x2a,
+  0x2f, 0x0a, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x69, 0x76, 0x5b, 0x5d, 0x20, 0x3d, 0x0a, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x78, 0x36, 0x61, 0x30, 0x39, 0x65, 0x36, 0x36, 0x37,
+  0x66, 0x33, 0x62, 0x63, 0x63, 0x39, 0x30, 0x38, 0x2c, 0x20, 0x30, 0x78,
+  0x62, 0x62, 0x36, 0x37, 0x61, 0x65, 0x38, 0x35, 0x38, 0x34, 0x63, 0x61,
+  0x61, 0x37, 0x33, 0x62, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x78,
+  0x33, 0x63, 0x36, 0x65, 0x66, 0x33, 0x37, 0x32, 0x66, 0x65, 0x39, 0x34,
+  0x66, 0x38, 0x32, 0x62, 0x2c, 0x20, 0x30, 0x78, 0x61, 0x35, 0x34, 0x66,
+  0x66, 0x35, 0x33, 0x61, 0x35, 0x66, 0x31, 0x64, 0x33, 0x36, 0x66, 0x31,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x30, 0x78, 0x35, 0x31, 0x30, 0x65,
+  0x35, 0x32, 0x37, 0x66, 0x61, 0x64, 0x65, 0x36, 0x38, 0x32, 0x64, 0x31,
+  0x2c, 0x20, 0x30, 0x78, 0x39, 0x62, 0x30, 0x35, 0x36, 0x38, 0x38, 0x63,
+  0x32, 0x62, 0x33, 0x65, 0x36, 0x63, 0x31, 0x66, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x78, 0x31, 0x66, 0x38, 0x33, 0x64, 0x39, 0x61, 0x62,
+  0x66, 0x62, 0x34, 0x31, 0x62, 0x64, 0x36, 0x62, 0x2c, 0x20, 0x30, 0x78,
+  0x35, 0x62, 0x65, 0x30, 0x63, 0x64, 0x31, 0x39, 0x31, 0x33, 0x37, 0x65,
+  0x32, 0x31, 0x37, 0x39, 0x2c, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x5f, 0x5f,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x75, 0x63, 0x68,
+  0x61, 0x72, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67,
+  0x6d, 0x61, 0x5b, 0x31, 0x32, 0x5d, 0x5b, 0x31, 0x36, 0x5d, 0x20, 0x3d,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x20,
+  0x33, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x20,
+  0x36, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x20,
+  0x39, 0x2c, 0x20, 0x31, 0x30, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x31,
+  0x32, 0x2c, 0x20, 0x31, 0x33, 0x2c, 0x20, 0x31, 0x34, 0x2c, 0x20, 0x31,
+  0x35, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x20, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x30, 0x2c, 0x20, 0x20, 0x34, 0x2c,
+  0x20, 0x20, 0x38, 0x2c, 0x20, 0x20, 0x39, 0x2c, 0x20, 0x31, 0x35, 0x2c,
+  0x20, 0x31, 0x33, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x31, 0x2c,
+  0x20, 0x31, 0x32, 0x2c, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x32, 0x2c,
+  0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x20, 0x35, 0x2c,
+  0x20, 0x20, 0x33, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x31,
+  0x32, 0x2c, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x20,
+  0x32, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x31, 0x33, 0x2c, 0x20, 0x31,
+  0x30, 0x2c, 0x20, 0x31, 0x34, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20, 0x20,
+  0x36, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x20,
+  0x39, 0x2c, 0x20, 0x20, 0x34, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x20, 0x39, 0x2c,
+  0x20, 0x20, 0x33, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x33, 0x2c,
+  0x20, 0x31, 0x32, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x31, 0x34, 0x2c,
+  0x20, 0x20, 0x32, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x35, 0x2c,
+  0x20, 0x31, 0x30, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x31, 0x35, 0x2c, 0x20, 0x20, 0x38, 0x20, 0x7d, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x20, 0x39, 0x2c, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x20,
+  0x32, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x31, 0x30, 0x2c, 0x20, 0x31,
+  0x35, 0x2c, 0x20, 0x31, 0x34, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x31,
+  0x31, 0x2c, 0x20, 0x31, 0x32, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20,
+  0x38, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20, 0x31, 0x33, 0x20, 0x7d, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x20, 0x32, 0x2c,
+  0x20, 0x31, 0x32, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x31, 0x30, 0x2c,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x38, 0x2c,
+  0x20, 0x20, 0x33, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x31, 0x33, 0x2c,
+  0x20, 0x20, 0x37, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x31, 0x35, 0x2c,
+  0x20, 0x31, 0x34, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x20, 0x39, 0x20,
+  0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x31,
+  0x32, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x31,
+  0x35, 0x2c, 0x20, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x33, 0x2c, 0x20, 0x20,
+  0x34, 0x2c, 0x20, 0x31, 0x30, 0x2c, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x37, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20, 0x20,
+  0x39, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x31,
+  0x31, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x20, 0x31, 0x33, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x37, 0x2c,
+  0x20, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x32, 0x2c, 0x20, 0x20, 0x31, 0x2c,
+  0x20, 0x20, 0x33, 0x2c, 0x20, 0x20, 0x39, 0x2c, 0x20, 0x20, 0x35, 0x2c,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x20, 0x34, 0x2c,
+  0x20, 0x20, 0x38, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x32, 0x2c,
+  0x20, 0x31, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x31,
+  0x34, 0x2c, 0x20, 0x20, 0x39, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20,
+  0x33, 0x2c, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x31,
+  0x32, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x31, 0x33, 0x2c, 0x20, 0x20,
+  0x37, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x31,
+  0x30, 0x2c, 0x20, 0x20, 0x35, 0x20, 0x7d, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x20, 0x31, 0x30, 0x2c, 0x20, 0x20, 0x32, 0x2c,
+  0x20, 0x20, 0x38, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x37, 0x2c,
+  0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x20, 0x35, 0x2c,
+  0x20, 0x31, 0x35, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x39, 0x2c,
+  0x20, 0x31, 0x34, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20, 0x31, 0x32, 0x2c,
+  0x20, 0x31, 0x33, 0x2c, 0x20, 0x20, 0x30, 0x20, 0x7d, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x31, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20, 0x20,
+  0x34, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20,
+  0x37, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x20, 0x39, 0x2c, 0x20, 0x31,
+  0x30, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x31, 0x32, 0x2c, 0x20, 0x31,
+  0x33, 0x2c, 0x20, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x35, 0x20, 0x7d, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x20, 0x31, 0x34, 0x2c,
+  0x20, 0x31, 0x30, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x38, 0x2c,
+  0x20, 0x20, 0x39, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x31, 0x33, 0x2c,
+  0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x32, 0x2c,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x31, 0x31, 0x2c,
+  0x20, 0x20, 0x37, 0x2c, 0x20, 0x20, 0x35, 0x2c, 0x20, 0x20, 0x33, 0x20,
+  0x7d, 0x7d, 0x3b, 0x0a, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x47, 0x28, 0x76, 0x61, 0x2c, 0x20,
+  0x76, 0x62, 0x2c, 0x20, 0x76, 0x63, 0x2c, 0x20, 0x76, 0x64, 0x2c, 0x20,
+  0x78, 0x2c, 0x20, 0x79, 0x29, 0x20, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x76, 0x61, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x20, 0x2b, 0x20,
+  0x76, 0x62, 0x20, 0x2b, 0x20, 0x78, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09,
+  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x64, 0x20, 0x3d, 0x20, 0x72,
+  0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x64, 0x20, 0x5e, 0x20, 0x76,
+  0x61, 0x2c, 0x20, 0x33, 0x32, 0x55, 0x4c, 0x29, 0x3b, 0x20, 0x09, 0x09,
+  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x63, 0x20, 0x3d, 0x20, 0x76,
+  0x63, 0x20, 0x2b, 0x20, 0x76, 0x64, 0x3b, 0x20, 0x09, 0x09, 0x09, 0x09,
+  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x62, 0x20, 0x3d, 0x20, 0x72,
+  0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x62, 0x20, 0x5e, 0x20, 0x76,
+  0x63, 0x2c, 0x20, 0x34, 0x30, 0x55, 0x4c, 0x29, 0x3b, 0x20, 0x09, 0x09,
+  0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x20, 0x3d, 0x20, 0x76,
+  0x61, 0x20, 0x2b, 0x20, 0x76, 0x62, 0x20, 0x2b, 0x20, 0x79, 0x3b, 0x20,
+  0x09, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x64,
+  0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x64,
+  0x20, 0x5e, 0x20, 0x76, 0x61, 0x2c, 0x20, 0x34, 0x38, 0x55, 0x4c, 0x29,
+  0x3b, 0x20, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x63,
+  0x20, 0x3d, 0x20, 0x76, 0x63, 0x20, 0x2b, 0x20, 0x76, 0x64, 0x3b, 0x20,
+  0x09, 0x09, 0x09, 0x09, 0x5c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x62,
+  0x20, 0x3d, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x76, 0x62,
+  0x20, 0x5e, 0x20, 0x76, 0x63, 0x2c, 0x20, 0x31, 0x55, 0x4c, 0x29, 0x3b,
+  0x0a, 0x0a, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x34, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x50, 0x72, 0x65,
+  0x50, 0x6f, 0x77, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x68,
+  0x65, 0x61, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x4e, 0x6f, 0x6e, 0x63, 0x65, 0x29,
+  0x20, 0x7b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x5b,
+  0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+  0x76, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x6d, 0x5b, 0x30,
+  0x5d, 0x20, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x73,
+  0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x68,
+  0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x73, 0x31, 0x3b, 0x0a, 0x09, 0x6d,
+  0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+  0x2e, 0x73, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x5b, 0x33, 0x5d, 0x20, 0x3d,
+  0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2e, 0x73, 0x33, 0x3b, 0x0a,
+  0x09, 0x6d, 0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x6e, 0x63,
+  0x65, 0x3b, 0x0a, 0x09, 0x6d, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x28,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61,
+  0x4e, 0x6f, 0x6e, 0x63, 0x65, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x36, 0x3b, 0x20, 0x69,
+  0x3c, 0x31, 0x36, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x6d, 0x5b,
+  0x69, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x6c,
+  0x6f, 0x6e, 0x67, 0x20, 0x68, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x68,
+  0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f,
+  0x69, 0x76, 0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x28, 0x30, 0x78, 0x30,
+  0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x20, 0x7c, 0x20, 0x33, 0x32,
+  0x29, 0x3b, 0x0a, 0x09, 0x68, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x62,
+  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x31, 0x5d, 0x3b, 0x0a,
+  0x09, 0x68, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x69, 0x76, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x68, 0x5b,
+  0x33, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69,
+  0x76, 0x5b, 0x33, 0x5d, 0x3b, 0x0a, 0x09, 0x68, 0x5b, 0x34, 0x5d, 0x20,
+  0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x34,
+  0x5d, 0x3b, 0x0a, 0x09, 0x68, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x62,
+  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x35, 0x5d, 0x3b, 0x0a,
+  0x09, 0x68, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x69, 0x76, 0x5b, 0x36, 0x5d, 0x20, 0x5e, 0x20, 0x30, 0x78,
+  0x35, 0x37, 0x36, 0x46, 0x35, 0x30, 0x32, 0x44, 0x32, 0x44, 0x37, 0x33,
+  0x36, 0x34, 0x34, 0x38, 0x3b, 0x09, 0x2f, 0x2f, 0x20, 0x45, 0x71, 0x75,
+  0x61, 0x6c, 0x73, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6f, 0x6e, 0x61, 0x6c,
+  0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x72, 0x69,
+  0x6e, 0x67, 0x20, 0x22, 0x48, 0x64, 0x73, 0x2d, 0x2d, 0x50, 0x6f, 0x57,
+  0x22, 0x0a, 0x09, 0x68, 0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x6c,
+  0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b, 0x37, 0x5d, 0x20, 0x5e, 0x20,
+  0x28, 0x28, 0x35, 0x55, 0x4c, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32, 0x29,
+  0x20, 0x7c, 0x20, 0x34, 0x34, 0x38, 0x29, 0x3b, 0x09, 0x2f, 0x2f, 0x20,
+  0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6e, 0x0a, 0x0a, 0x09, 0x66, 0x6f,
+  0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b,
+  0x20, 0x69, 0x3c, 0x38, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x09, 0x76, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x68, 0x5b,
+  0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x5b, 0x69, 0x2b, 0x38, 0x5d,
+  0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x76, 0x5b,
+  0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x76, 0x5b, 0x31,
+  0x32, 0x5d, 0x20, 0x5e, 0x3d, 0x20, 0x34, 0x34, 0x3b, 0x09, 0x09, 0x2f,
+  0x2f, 0x20, 0x33, 0x32, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x20, 0x2b, 0x20, 0x38, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20,
+  0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 0x34, 0x20, 0x62, 0x79,
+  0x74, 0x65, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x6e, 0x6f, 0x6e,
+  0x63, 0x65, 0x0a, 0x09, 0x76, 0x5b, 0x31, 0x34, 0x5d, 0x20, 0x5e, 0x3d,
+  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2d, 0x31, 0x3b,
+  0x09, 0x2f, 0x2f, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x72, 0x3d, 0x30, 0x3b, 0x20, 0x72, 0x3c, 0x31,
+  0x32, 0x3b, 0x20, 0x72, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x62, 0x6c, 0x61, 0x6b, 0x65, 0x47, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c,
+  0x20, 0x20, 0x76, 0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62,
+  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72,
+  0x5d, 0x5b, 0x30, 0x5d, 0x5d, 0x2c, 0x20, 0x20, 0x6d, 0x5b, 0x62, 0x6c,
+  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d,
+  0x5b, 0x31, 0x5d, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6c, 0x61,
+  0x6b, 0x65, 0x47, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76,
+  0x5b, 0x31, 0x33, 0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x32,
+  0x5d, 0x5d, 0x2c, 0x20, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x33, 0x5d,
+  0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x47,
+  0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x36, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x34,
+  0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73,
+  0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x34, 0x5d, 0x5d, 0x2c,
+  0x20, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69,
+  0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x35, 0x5d, 0x5d, 0x29, 0x3b,
+  0x0a, 0x09, 0x09, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x47, 0x28, 0x76, 0x5b,
+  0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20,
+  0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d,
+  0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x36, 0x5d, 0x5d, 0x2c, 0x20, 0x20, 0x6d,
+  0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61,
+  0x5b, 0x72, 0x5d, 0x5b, 0x37, 0x5d, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x62, 0x6c, 0x61, 0x6b, 0x65, 0x47, 0x28, 0x76, 0x5b, 0x30, 0x5d, 0x2c,
+  0x20, 0x76, 0x5b, 0x35, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x31, 0x35, 0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62,
+  0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72,
+  0x5d, 0x5b, 0x38, 0x5d, 0x5d, 0x2c, 0x20, 0x20, 0x6d, 0x5b, 0x62, 0x6c,
+  0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d,
+  0x5b, 0x39, 0x5d, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6c, 0x61,
+  0x6b, 0x65, 0x47, 0x28, 0x76, 0x5b, 0x31, 0x5d, 0x2c, 0x20, 0x76, 0x5b,
+  0x36, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x2c, 0x20, 0x76,
+  0x5b, 0x31, 0x32, 0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b,
+  0x65, 0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x31,
+  0x30, 0x5d, 0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x5f, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x31, 0x31,
+  0x5d, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6c, 0x61, 0x6b, 0x65,
+  0x47, 0x28, 0x76, 0x5b, 0x32, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x37, 0x5d,
+  0x2c, 0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31,
+  0x33, 0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f,
+  0x73, 0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x31, 0x32, 0x5d,
+  0x5d, 0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73,
+  0x69, 0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x31, 0x33, 0x5d, 0x5d,
+  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x47, 0x28,
+  0x76, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x76, 0x5b, 0x34, 0x5d, 0x2c, 0x20,
+  0x76, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x20, 0x76, 0x5b, 0x31, 0x34, 0x5d,
+  0x2c, 0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69,
+  0x67, 0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x31, 0x34, 0x5d, 0x5d, 0x2c,
+  0x20, 0x6d, 0x5b, 0x62, 0x6c, 0x61, 0x6b, 0x65, 0x5f, 0x73, 0x69, 0x67,
+  0x6d, 0x61, 0x5b, 0x72, 0x5d, 0x5b, 0x31, 0x35, 0x5d, 0x5d, 0x29, 0x3b,
+  0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x29, 0x20, 0x28, 0x68,
+  0x5b, 0x30, 0x5d, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x30, 0x5d, 0x20, 0x5e,
+  0x20, 0x76, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x68, 0x5b, 0x31, 0x5d, 0x20,
+  0x5e, 0x20, 0x76, 0x5b, 0x31, 0x5d, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x39,
+  0x5d, 0x2c, 0x20, 0x68, 0x5b, 0x32, 0x5d, 0x20, 0x5e, 0x20, 0x76, 0x5b,
+  0x32, 0x5d, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x31, 0x30, 0x5d, 0x2c, 0x20,
+  0x68, 0x5b, 0x33, 0x5d, 0x20, 0x5e, 0x20, 0x76, 0x5b, 0x33, 0x5d, 0x20,
+  0x5e, 0x20, 0x76, 0x5b, 0x31, 0x31, 0x5d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20,
+  0x64, 0x65, 0x72, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x20, 0x6f, 0x66, 0x20, 0x6f,
+  0x6e, 0x65, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69,
+  0x63, 0x65, 0x0a, 0x09, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x6f, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x73, 0x5b, 0x69,
+  0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x0a, 0x2a, 0x2f,
+  0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x68, 0x64, 0x73, 0x48, 0x61, 0x73, 0x68, 0x49, 0x49,
+  0x49, 0x5f, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x20, 0x28, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x34, 0x20, 0x2a, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x73, 0x2c,
   0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20,
-  0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x49, 0x64, 0x20, 0x3d, 0x20, 0x67,
+  0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x2c,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6e,
+  0x6f, 0x6e, 0x63, 0x65, 0x53, 0x74, 0x65, 0x70, 0x2c, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61,
+  0x4e, 0x6f, 0x6e, 0x63, 0x65, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x69, 0x66, 0x20, 0x28, 0x67,
   0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64,
-  0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
-  0x38, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65,
-  0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61,
-  0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c,
-  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49,
-  0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x73,
-  0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65,
-  0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
-  0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b,
-  0x31, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x32,
-  0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34,
-  0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x3c,
-  0x20, 0x33, 0x29, 0x2b, 0x32, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65,
-  0x6d, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61,
-  0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c,
-  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49,
-  0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b, 0x33, 0x29, 0x3b, 0x0a,
-  0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x34, 0x20, 0x3d, 0x20, 0x73,
-  0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65,
-  0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
-  0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b,
-  0x34, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x35,
-  0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34,
-  0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x3c,
-  0x20, 0x33, 0x29, 0x2b, 0x35, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65,
-  0x6d, 0x2e, 0x73, 0x36, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61,
-  0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c,
-  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49,
-  0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b, 0x36, 0x29, 0x3b, 0x20,
-  0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x37, 0x20, 0x3d, 0x20,
-  0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x67, 0x49, 0x64, 0x3b,
-  0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x4d,
-  0x69, 0x78, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f,
-  0x75, 0x6e, 0x64, 0x20, 0x31, 0x0a, 0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d,
-  0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x72, 0x28,
-  0x65, 0x6c, 0x65, 0x6d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x69,
-  0x66, 0x20, 0x28, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20,
-  0x37, 0x35, 0x37, 0x39, 0x33, 0x37, 0x38, 0x29, 0x20, 0x7c, 0x7c, 0x20,
-  0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f,
-  0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x34, 0x37,
-  0x36, 0x30, 0x29, 0x29, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28,
-  0x22, 0x50, 0x6f, 0x73, 0x74, 0x4d, 0x69, 0x78, 0x3a, 0x20, 0x25, 0x64,
-  0x20, 0x25, 0x6c, 0x75, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x67, 0x65,
-  0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28,
-  0x30, 0x29, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20,
-  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
-  0x29, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69,
-  0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29,
-  0x3b, 0x0a, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e,
-  0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29,
-  0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
-  0x2d, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b,
-  0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x2a, 0x20, 0x62,
-  0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x0a,
-  0x09, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x70, 0x6f, 0x73,
-  0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x09, 0x0a, 0x0a,
+  0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x73, 0x5b, 0x69, 0x74,
+  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x20, 0x3d, 0x20, 0x62,
+  0x6c, 0x61, 0x6b, 0x65, 0x50, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x28, 0x68,
+  0x65, 0x61, 0x64, 0x65, 0x72, 0x2c, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65,
+  0x20, 0x2b, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x2a, 0x20, 0x6e, 0x6f, 0x6e, 0x63, 0x65, 0x53, 0x74, 0x65, 0x70,
+  0x2c, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x4e, 0x6f, 0x6e, 0x63, 0x65,
+  0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a,
+  0x09, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30, 0x20, 0x28, 0x73, 0x65,
+  0x65, 0x64, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x77, 0x6f, 0x72, 0x6b, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x0a, 0x2a, 0x2f,
+  0x0a, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x73, 0x65, 0x65, 0x64, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50,
+  0x6f, 0x77, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x49, 0x64, 0x20, 0x3d, 0x20,
+  0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69,
+  0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x6c, 0x6f, 0x6e,
+  0x67, 0x38, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x0a, 0x09, 0x65, 0x6c,
+  0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48,
+  0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
+  0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67,
+  0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x31, 0x20, 0x3d, 0x20,
+  0x73, 0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72,
+  0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x29, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29,
+  0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73,
+  0x32, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32,
+  0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c,
+  0x3c, 0x20, 0x33, 0x29, 0x2b, 0x32, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c,
+  0x65, 0x6d, 0x2e, 0x73, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48,
+  0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
+  0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67,
+  0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b, 0x33, 0x29, 0x3b,
+  0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x34, 0x20, 0x3d, 0x20,
+  0x73, 0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72,
+  0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x29, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29,
+  0x2b, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73,
+  0x35, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48, 0x61, 0x73, 0x68, 0x32,
+  0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x20, 0x28, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67, 0x49, 0x64, 0x20, 0x3c,
+  0x3c, 0x20, 0x33, 0x29, 0x2b, 0x35, 0x29, 0x3b, 0x0a, 0x09, 0x65, 0x6c,
+  0x65, 0x6d, 0x2e, 0x73, 0x36, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x70, 0x48,
+  0x61, 0x73, 0x68, 0x32, 0x34, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
+  0x2c, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x67,
+  0x49, 0x64, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29, 0x2b, 0x36, 0x29, 0x3b,
+  0x20, 0x0a, 0x09, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x37, 0x20, 0x3d,
+  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x67, 0x49, 0x64,
+  0x3b, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x20,
+  0x4d, 0x69, 0x78, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x20, 0x31, 0x0a, 0x0a, 0x09, 0x65, 0x6c, 0x65,
+  0x6d, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x72,
+  0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x2f, 0x2f,
+  0x69, 0x66, 0x20, 0x28, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d,
+  0x20, 0x37, 0x35, 0x37, 0x39, 0x33, 0x37, 0x38, 0x29, 0x20, 0x7c, 0x7c,
+  0x20, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x34,
+  0x37, 0x36, 0x30, 0x29, 0x29, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66,
+  0x28, 0x22, 0x50, 0x6f, 0x73, 0x74, 0x4d, 0x69, 0x78, 0x3a, 0x20, 0x25,
+  0x64, 0x20, 0x25, 0x6c, 0x75, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x67,
+  0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64,
+  0x28, 0x30, 0x29, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30,
+  0x20, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x29, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x30, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d,
+  0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x65, 0x72, 0x73, 0x5b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d,
+  0x29, 0x3b, 0x0a, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69,
+  0x6e, 0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x29, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
+  0x65, 0x2d, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x70, 0x6f, 0x73, 0x20,
+  0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x2a, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a,
+  0x0a, 0x09, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x70, 0x6f,
+  0x73, 0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x3b, 0x09, 0x0a,
+  0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
+  0x30, 0x20, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0a, 0x09, 0x57, 0x72,
+  0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x30, 0x0a, 0x2a, 0x2f, 0x0a, 0x5f, 0x5f, 0x61, 0x74,
+  0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72,
+  0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53, 0x69,
+  0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a,
+  0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x68, 0x64, 0x73, 0x48, 0x61, 0x73, 0x68, 0x49, 0x49, 0x49,
+  0x5f, 0x73, 0x65, 0x65, 0x64, 0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a,
+  0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66,
+  0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e,
+  0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74,
+  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70,
+  0x6f, 0x63, 0x68, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x0a,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x3c,
+  0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x5b, 0x30, 0x5d,
+  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x73, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x2a, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x53, 0x6c, 0x6f, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3d,
+  0x20, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x73, 0x65, 0x65, 0x64, 0x45,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x70, 0x72, 0x65, 0x50, 0x6f,
+  0x77, 0x2c, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x30,
+  0x20, 0x28, 0x73, 0x65, 0x65, 0x64, 0x29, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x20,
+  0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x0a, 0x09, 0x57,
+  0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x30, 0x0a, 0x09, 0x57, 0x68, 0x65, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x70, 0x75, 0x62,
+  0x6c, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61, 0x20, 0x6e, 0x65, 0x77,
+  0x20, 0x6a, 0x6f, 0x62, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x74, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x73, 0x20, 0x73, 0x6b,
+  0x69, 0x70, 0x70, 0x65, 0x64, 0x0a, 0x2a, 0x2f, 0x0a, 0x5f, 0x5f, 0x61,
+  0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28,
+  0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53,
+  0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29,
+  0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x68, 0x64, 0x73, 0x48, 0x61, 0x73, 0x68, 0x49, 0x49,
+  0x49, 0x5f, 0x73, 0x65, 0x65, 0x64, 0x44, 0x65, 0x76, 0x20, 0x28, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e,
+  0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
+  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72,
+  0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x34, 0x20, 0x2a, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
+  0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68,
+  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65,
+  0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x20, 0x3c, 0x20, 0x6a, 0x6f,
+  0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x5b, 0x30, 0x5d, 0x29, 0x20, 0x7b,
+  0x0a, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x69,
+  0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2a, 0x72, 0x65, 0x73,
+  0x75, 0x6c, 0x74, 0x53, 0x6c, 0x6f, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x5d,
+  0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x72, 0x65, 0x74, 0x75,
+  0x72, 0x6e, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x73, 0x65, 0x65,
+  0x64, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x70, 0x72, 0x65,
+  0x50, 0x6f, 0x77, 0x73, 0x5b, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
+  0x6f, 0x6e, 0x5d, 0x2c, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
+  0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x29, 0x3b,
   0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e,
   0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
   0x20, 0x31, 0x20, 0x0a, 0x09, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67,
@@ -243,205 +674,8 @@ unsigned char __hds_hash_III_cl[] = {
   0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65,
   0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20,
   0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65,
-  0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x6d, 0x48,
-  0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52, 0x31, 0x20, 0x28, 0x09,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f,
-  0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-  0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a,
-  0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
-  0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50,
-  0x6f, 0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x67,
-  0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f,
-  0x63, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x30,
-  0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20,
-  0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x20,
-  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f,
-  0x75, 0x74, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x34,
-  0x30, 0x39, 0x36, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66,
-  0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x3b, 0x0a, 0x0a,
-  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x30, 0x32, 0x34,
-  0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x32,
-  0x35, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x43, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
-  0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d,
-  0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x31, 0x30, 0x32, 0x34, 0x3b,
-  0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x69,
-  0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09,
-  0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a,
-  0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b,
-  0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
-  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72,
-  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64,
-  0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x69,
-  0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-  0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e,
-  0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
-  0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x69,
-  0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e,
-  0x20, 0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x29, 0x20,
-  0x3d, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x09,
-  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e,
-  0x63, 0x28, 0x26, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x50,
-  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x50,
-  0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x32,
-  0x35, 0x36, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x28,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20,
-  0x31, 0x34, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x74,
-  0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x78, 0x63,
-  0x68, 0x67, 0x28, 0x26, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x73, 0x6c,
-  0x6f, 0x74, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x29, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x5b, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x72,
-  0x65, 0x74, 0x20, 0x7c, 0x20, 0x28, 0x69, 0x20, 0x3c, 0x3c, 0x20, 0x31,
-  0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x0a,
-  0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b,
-  0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
-  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72,
-  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64,
-  0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x5b, 0x30, 0x5d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63,
-  0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30, 0x20,
-  0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x3e,
-  0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20,
-  0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x26, 0x20, 0x30,
-  0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x77, 0x68, 0x69,
-  0x6c, 0x65, 0x20, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d,
-  0x20, 0x21, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20,
-  0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68,
-  0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a,
-  0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x50, 0x6f, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x3e,
-  0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6e, 0x65, 0x78,
-  0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x2f, 0x2f, 0x20, 0x46, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
-  0x30, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b,
-  0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x50, 0x6f, 0x73, 0x30, 0x29, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09,
-  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x31, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-  0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e,
-  0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
-  0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65,
-  0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x31, 0x29, 0x5d, 0x3b, 0x0a, 0x0a,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x69, 0x6e, 0x67,
-  0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x69,
-  0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33, 0x20, 0x5e, 0x3d, 0x20,
-  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x30, 0x31,
-  0x32, 0x33, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x30, 0x2e, 0x73, 0x34, 0x35, 0x36, 0x20, 0x20, 0x5e, 0x3d,
-  0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x34,
-  0x35, 0x36, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53,
-  0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x26, 0x20, 0x53, 0x65, 0x72,
-  0x69, 0x61, 0x6c, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
-  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a,
-  0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x32, 0x20, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x75,
-  0x6c, 0x6f, 0x6e, 0x67, 0x32, 0x29, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x2c, 0x20, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x37, 0x29, 0x3b, 0x20, 0x0a,
-  0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65,
-  0x20, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
-  0x2e, 0x73, 0x37, 0x20, 0x3c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x31, 0x2e, 0x73, 0x37, 0x29, 0x20, 0x3f, 0x20, 0x69, 0x6e, 0x64,
-  0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x31, 0x20, 0x3a,
-  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73,
-  0x31, 0x30, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d, 0x20, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x20,
-  0x7c, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65,
-  0x2e, 0x73, 0x31, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x35, 0x29, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
-  0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x29, 0x20, 0x34, 0x30, 0x38, 0x39, 0x31, 0x31, 0x39, 0x20, 0x20,
-  0x7c, 0x20, 0x28, 0x28, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20,
-  0x32, 0x34, 0x34, 0x37, 0x38, 0x35, 0x37, 0x34, 0x29, 0x20, 0x3c, 0x3c,
-  0x20, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f,
-  0x20, 0x53, 0x68, 0x69, 0x66, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x77,
-  0x61, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6a, 0x75, 0x73, 0x74, 0x20,
-  0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x69, 0x74, 0x73,
-  0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
-  0x20, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x32, 0x34, 0x28, 0x73,
-  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4d, 0x69, 0x78, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x0a, 0x09, 0x09, 0x09,
-  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x20,
-  0x3d, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x72, 0x28, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f,
-  0x2f, 0x20, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x73, 0x6f, 0x72,
-  0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
-  0x32, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
-  0x29, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
-  0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d,
-  0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28,
-  0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6f, 0x75,
-  0x74, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20,
-  0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2d, 0x31, 0x29, 0x29, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09,
-  0x09, 0x09, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x5b, 0x70, 0x6f,
-  0x73, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
-  0x30, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x20, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65,
-  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
-  0x32, 0x20, 0x0a, 0x09, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20,
-  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31,
-  0x0a, 0x09, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f,
-  0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x0a, 0x2a, 0x2f, 0x0a,
-  0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f,
-  0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b,
-  0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28,
-  0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31,
-  0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
-  0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x6d, 0x48, 0x61,
-  0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52, 0x32, 0x20, 0x28, 0x09, 0x5f,
+  0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x64, 0x73, 0x48, 0x61,
+  0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52, 0x31, 0x20, 0x28, 0x09, 0x5f,
   0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e,
   0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
   0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
@@ -453,15 +687,227 @@ unsigned char __hds_hash_III_cl[] = {
   0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72,
   0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
   0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f,
-  0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65,
-  0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30,
-  0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x63,
-  0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x30, 0x29,
-  0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a,
+  0x77, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x6c, 0x6f, 0x74, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74,
+  0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a,
+  0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x29,
+  0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x53, 0x69,
+  0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x30, 0x29, 0x3b, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x73,
+  0x6b, 0x69, 0x70, 0x4f, 0x6e, 0x4e, 0x65, 0x77, 0x4a, 0x6f, 0x62, 0x28,
+  0x6c, 0x49, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x3b, 0x0a, 0x09,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x32,
+  0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x4f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4f,
+  0x66, 0x73, 0x20, 0x3d, 0x20, 0x34, 0x30, 0x39, 0x36, 0x3b, 0x0a, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20,
+  0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x5b, 0x32, 0x35, 0x36, 0x30, 0x5d, 0x3b, 0x0a,
+  0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69,
+  0x3c, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f,
+  0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x69,
+  0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x20,
+  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
+  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
+  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e,
+  0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53,
+  0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32,
+  0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x2c, 0x20, 0x69, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32, 0x29, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x33, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x6d, 0x61, 0x73,
+  0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x69, 0x6e, 0x43,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d,
+  0x69, 0x6e, 0x28, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x29, 0x20, 0x32, 0x35, 0x36, 0x30, 0x29, 0x3b, 0x0a,
+  0x09, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c,
+  0x6f, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e,
+  0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x33, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x69, 0x63, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x6d, 0x61,
+  0x74, 0x63, 0x68, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2c, 0x20, 0x69,
+  0x6e, 0x50, 0x6f, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09,
+  0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x6e, 0x50, 0x6f,
+  0x73, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x65, 0x74, 0x20, 0x7c, 0x20, 0x28,
+  0x69, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69,
+  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
+  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x3b, 0x20,
+  0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x50, 0x6f, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c,
+  0x65, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x45,
+  0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b,
+  0x69, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a,
+  0x0a, 0x09, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6e, 0x65,
+  0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x78,
+  0x46, 0x46, 0x46, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20,
+  0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x31, 0x20, 0x3d,
+  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45,
+  0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20,
+  0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74,
+  0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46,
+  0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x65,
+  0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x65, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73,
+  0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30, 0x29,
+  0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38,
+  0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x20, 0x3d, 0x20,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32,
+  0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73,
+  0x31, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x78, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77,
+  0x6f, 0x72, 0x6b, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09,
+  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x31,
+  0x32, 0x33, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
+  0x77, 0x31, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x34,
+  0x35, 0x36, 0x20, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52,
+  0x6f, 0x77, 0x31, 0x2e, 0x73, 0x34, 0x35, 0x36, 0x3b, 0x0a, 0x0a, 0x09,
+  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67,
+  0x20, 0x26, 0x20, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x69,
+  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x32, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
+  0x65, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x32, 0x29,
+  0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
+  0x37, 0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e,
+  0x73, 0x37, 0x29, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x74,
+  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x3c, 0x20,
+  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x37, 0x29,
+  0x20, 0x3f, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65,
+  0x2e, 0x73, 0x30, 0x31, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x30, 0x3b, 0x20, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
+  0x73, 0x37, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72,
+  0x65, 0x65, 0x2e, 0x73, 0x30, 0x20, 0x7c, 0x20, 0x28, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x3c, 0x3c,
+  0x20, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d,
+  0x20, 0x28, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x34, 0x30, 0x38,
+  0x39, 0x31, 0x31, 0x39, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x28, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x32, 0x34, 0x34, 0x37, 0x38, 0x35,
+  0x37, 0x34, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x35, 0x29, 0x3b, 0x0a,
+  0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65,
+  0x64, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74,
+  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x69,
+  0x66, 0x74, 0x32, 0x34, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4d,
+  0x69, 0x78, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x32, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
+  0x77, 0x30, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x65,
+  0x72, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x29, 0x3b,
+  0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x42, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x0a, 0x09, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d,
+  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69,
+  0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x5b, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4f, 0x66,
+  0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e,
+  0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29,
+  0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
+  0x2d, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73,
+  0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x2a,
+  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b,
+  0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x75, 0x66, 0x66,
+  0x65, 0x72, 0x31, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x3b, 0x09, 0x0a, 0x09, 0x09,
+  0x7d, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x7d, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a,
+  0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x32, 0x20, 0x0a, 0x09, 0x52, 0x65,
+  0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x62,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x0a, 0x09, 0x57, 0x72, 0x69, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+  0x72, 0x30, 0x0a, 0x2a, 0x2f, 0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71,
+  0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65,
+  0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f,
+  0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x68, 0x64, 0x73, 0x48, 0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52,
+  0x32, 0x20, 0x28, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e,
+  0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31,
+  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20,
+  0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68,
+  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65,
+  0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d,
+  0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69,
+  0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65,
+  0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65,
+  0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c,
+  0x49, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74,
+  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29,
+  0x3b, 0x0a, 0x0a, 0x09, 0x73, 0x6b, 0x69, 0x70, 0x4f, 0x6e, 0x4e, 0x65,
+  0x77, 0x4a, 0x6f, 0x62, 0x28, 0x6c, 0x49, 0x64, 0x29, 0x3b, 0x0a, 0x0a,
   0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x20,
   0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x26, 0x20, 0x30,
   0x78, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20,
@@ -673,275 +1119,8 @@ unsigned char __hds_hash_III_cl[] = {
   0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a,
   0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c,
   0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e,
-  0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x6d,
-  0x48, 0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52, 0x33, 0x20, 0x28,
-  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
-  0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
-  0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67,
-  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a,
-  0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09,
-  0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65,
-  0x50, 0x6f, 0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20,
-  0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64,
-  0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c,
-  0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74,
-  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49,
-  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x20, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73,
-  0x20, 0x3d, 0x20, 0x38, 0x31, 0x39, 0x32, 0x3b, 0x0a, 0x09, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73,
-  0x20, 0x3d, 0x20, 0x31, 0x32, 0x32, 0x38, 0x38, 0x3b, 0x0a, 0x0a, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d,
-  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x6e,
-  0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b, 0x65,
-  0x74, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
-  0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x61,
-  0x62, 0x6c, 0x65, 0x5b, 0x32, 0x35, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09,
-  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x31,
-  0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c,
-  0x31, 0x30, 0x32, 0x34, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63,
-  0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6d, 0x61,
-  0x74, 0x63, 0x68, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46,
-  0x46, 0x46, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x69, 0x6e,
-  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x20, 0x3d,
-  0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65,
-  0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f,
-  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e, 0x4c,
-  0x69, 0x6d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69,
-  0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e,
-  0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x62,
-  0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34,
-  0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x2c, 0x20, 0x69, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e,
-  0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32, 0x29, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x33, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b,
-  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d,
-  0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x69, 0x6e, 0x43, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69,
-  0x6e, 0x28, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x29, 0x20, 0x32, 0x35, 0x36, 0x30, 0x29, 0x3b, 0x0a, 0x09,
-  0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f,
-  0x74, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73,
-  0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20, 0x30,
-  0x78, 0x33, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d,
-  0x69, 0x63, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x6d, 0x61, 0x74,
-  0x63, 0x68, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2c, 0x20, 0x69, 0x6e,
-  0x50, 0x6f, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09,
-  0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x6e, 0x50, 0x6f, 0x73,
-  0x5d, 0x20, 0x3d, 0x20, 0x72, 0x65, 0x74, 0x20, 0x7c, 0x20, 0x28, 0x69,
-  0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d,
-  0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65,
-  0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f,
-  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e, 0x43,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x3b, 0x20, 0x69,
-  0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b,
-  0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d,
-  0x50, 0x6f, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c,
-  0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69,
-  0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a,
-  0x09, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6e, 0x65, 0x78,
-  0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x78, 0x46,
-  0x46, 0x46, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
-  0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74,
-  0x61, 0x62, 0x6c, 0x65, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x31, 0x20, 0x3d, 0x20,
-  0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c,
-  0x65, 0x6d, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d,
-  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45,
-  0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46,
-  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x65, 0x74,
-  0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68,
-  0x65, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a,
-  0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x74,
-  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66,
-  0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28,
-  0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
-  0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30, 0x29, 0x5d,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
-  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x20, 0x3d, 0x20, 0x62,
-  0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34,
-  0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b,
-  0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x31,
-  0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x78,
-  0x6f, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6f,
-  0x72, 0x6b, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x30, 0x20, 0x74, 0x6f,
-  0x20, 0x34, 0x30, 0x30, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33, 0x20, 0x5e,
-  0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73,
-  0x30, 0x31, 0x32, 0x33, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x34, 0x35, 0x20, 0x20, 0x5e,
-  0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73,
-  0x34, 0x35, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36, 0x20, 0x5e, 0x3d, 0x20, 0x28, 0x73,
-  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x36, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c, 0x29, 0x3b, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x6f, 0x72, 0x74, 0x69,
-  0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f,
-  0x6e, 0x67, 0x34, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
-  0x65, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x73,
-  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36, 0x37, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
-  0x65, 0x2e, 0x73, 0x32, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x36, 0x37, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x20, 0x3d,
-  0x20, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
-  0x65, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29, 0x20,
-  0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29,
-  0x20, 0x3c, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72,
-  0x65, 0x65, 0x2e, 0x73, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29,
-  0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
-  0x29, 0x29, 0x20, 0x3f, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72,
-  0x65, 0x65, 0x20, 0x3a, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72,
-  0x65, 0x65, 0x2e, 0x73, 0x32, 0x33, 0x30, 0x31, 0x3b, 0x20, 0x0a, 0x09,
-  0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e,
-  0x73, 0x30, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x32, 0x20, 0x3e, 0x3e, 0x20,
-  0x31, 0x36, 0x29, 0x3b, 0x0a, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f,
-  0x69, 0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20,
-  0x30, 0x29, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x52,
-  0x32, 0x20, 0x6f, 0x75, 0x74, 0x3a, 0x20, 0x5c, 0x6e, 0x25, 0x64, 0x20,
-  0x25, 0x64, 0x20, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20, 0x5c, 0x6e, 0x5c,
-  0x6e, 0x22, 0x2c, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72,
-  0x65, 0x65, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46,
-  0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x2c, 0x20, 0x28, 0x28, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x20, 0x3e,
-  0x3e, 0x20, 0x32, 0x35, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x46,
-  0x46, 0x46, 0x46, 0x46, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x33, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x33, 0x29,
-  0x2c, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
-  0x65, 0x2e, 0x73, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x29, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x2c,
-  0x20, 0x28, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65,
-  0x2e, 0x73, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x37, 0x29, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x29,
-  0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
-  0x53, 0x68, 0x69, 0x66, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x77, 0x61,
-  0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6a, 0x75, 0x73, 0x74, 0x20, 0x6d,
-  0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a,
-  0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
-  0x73, 0x36, 0x20, 0x26, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46,
-  0x55, 0x4c, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20,
-  0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x32, 0x34, 0x28, 0x73, 0x74,
-  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x2f, 0x2f, 0x20, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a,
-  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x20, 0x28, 0x4c, 0x6f, 0x77, 0x20,
-  0x70, 0x61, 0x72, 0x74, 0x29, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x35, 0x20, 0x7c, 0x3d, 0x20,
-  0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73,
-  0x30, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36,
-  0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
-  0x65, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x3b, 0x09,
-  0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
-  0x2e, 0x73, 0x36, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x3c, 0x3c, 0x20,
-  0x34, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x20,
-  0x3e, 0x3e, 0x20, 0x32, 0x34, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x32, 0x20, 0x3c,
-  0x3c, 0x20, 0x32, 0x38, 0x29, 0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09,
-  0x2f, 0x2f, 0x20, 0x4d, 0x69, 0x78, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72,
-  0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74,
-  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20,
-  0x6d, 0x69, 0x78, 0x65, 0x72, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
-  0x44, 0x72, 0x6f, 0x70, 0x20, 0x6f, 0x66, 0x20, 0x36, 0x34, 0x20, 0x62,
-  0x69, 0x74, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x69,
-  0x78, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
-  0x30, 0x2e, 0x73, 0x34, 0x20, 0x26, 0x3d, 0x20, 0x30, 0x78, 0x30, 0x30,
-  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
-  0x46, 0x46, 0x55, 0x4c, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x34, 0x20, 0x7c, 0x3d, 0x20,
-  0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x35,
-  0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30,
-  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x55, 0x4c, 0x29,
-  0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x2e, 0x73, 0x35, 0x36, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36, 0x37, 0x3b, 0x0a, 0x0a,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x41, 0x64, 0x64, 0x20, 0x74, 0x68,
-  0x65, 0x20, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x20, 0x62, 0x69, 0x74,
-  0x73, 0x20, 0x28, 0x68, 0x69, 0x67, 0x68, 0x20, 0x68, 0x61, 0x6c, 0x66,
-  0x29, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
-  0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x32, 0x20, 0x3e, 0x3e, 0x20,
-  0x33, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x7c, 0x3d, 0x20, 0x28,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x33,
-  0x20, 0x3c, 0x3c, 0x20, 0x31, 0x32, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09,
-  0x09, 0x2f, 0x2f, 0x20, 0x42, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x73,
-  0x6f, 0x72, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e,
-  0x64, 0x20, 0x34, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x29, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
-  0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73,
-  0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e,
-  0x63, 0x28, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b,
-  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x2b, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x70,
-  0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x70, 0x6f, 0x73,
-  0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x28, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2d, 0x31, 0x29, 0x29,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x63,
-  0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x0a,
-  0x09, 0x09, 0x09, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x5b, 0x70,
-  0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x20, 0x0a,
-  0x7d, 0x0a, 0x0a, 0x0a, 0x2f, 0x2a, 0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e,
-  0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64,
-  0x20, 0x34, 0x20, 0x0a, 0x09, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67,
-  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
-  0x31, 0x0a, 0x09, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74,
-  0x6f, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x0a, 0x2a, 0x2f,
-  0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-  0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72,
-  0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65,
-  0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20,
-  0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65,
-  0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x6d, 0x48,
-  0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52, 0x34, 0x20, 0x28, 0x09,
+  0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x68, 0x64, 0x73, 0x48,
+  0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f, 0x52, 0x33, 0x20, 0x28, 0x09,
   0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f,
   0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
   0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
@@ -953,15 +1132,297 @@ unsigned char __hds_hash_III_cl[] = {
   0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
   0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09,
   0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50,
-  0x6f, 0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x67,
-  0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28,
-  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f,
-  0x63, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x30,
-  0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a,
+  0x6f, 0x77, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61,
+  0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
+  0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63, 0x68, 0x2c, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68,
+  0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74,
+  0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29,
+  0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x53,
+  0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x30, 0x29, 0x3b,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
+  0x73, 0x6b, 0x69, 0x70, 0x4f, 0x6e, 0x4e, 0x65, 0x77, 0x4a, 0x6f, 0x62,
+  0x28, 0x6c, 0x49, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x3b, 0x0a,
+  0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3e, 0x3e, 0x20,
+  0x32, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x38, 0x31, 0x39,
+  0x32, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x75, 0x74,
+  0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x32,
+  0x38, 0x38, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69,
+  0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x73, 0x5b, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73,
+  0x2b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
+  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d,
+  0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x32, 0x35,
+  0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x66,
+  0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c,
+  0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x20,
+  0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20,
+  0x7b, 0x0a, 0x09, 0x09, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x69, 0x5d,
+  0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x7d,
+  0x20, 0x0a, 0x0a, 0x09, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09,
+  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b,
+  0x20, 0x69, 0x3c, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x69, 0x2b,
+  0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
+  0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
+  0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x69, 0x29,
+  0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x28,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20,
+  0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x29, 0x20, 0x3d,
+  0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20,
+  0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63,
+  0x28, 0x26, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x50, 0x6f,
+  0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x50, 0x6f,
+  0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x32, 0x35,
+  0x36, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x34, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20,
+  0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x78, 0x63, 0x68,
+  0x67, 0x28, 0x26, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x73, 0x6c, 0x6f,
+  0x74, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x29, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x5b, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x65,
+  0x74, 0x20, 0x7c, 0x20, 0x28, 0x69, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36,
+  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09,
+  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b,
+  0x20, 0x69, 0x3c, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x5b, 0x30, 0x5d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53,
+  0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30, 0x20, 0x3d,
+  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x77, 0x68, 0x69, 0x6c,
+  0x65, 0x20, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20,
+  0x21, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x69,
+  0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x72,
+  0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x09,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50,
+  0x6f, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b,
+  0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6e, 0x65, 0x78, 0x74,
+  0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x46, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x65, 0x6c, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
+  0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d,
+  0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x50, 0x6f, 0x73, 0x30, 0x29, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75,
+  0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
+  0x77, 0x31, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
+  0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
+  0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x50, 0x6f, 0x73, 0x31, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
+  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x62, 0x69, 0x74,
+  0x73, 0x20, 0x30, 0x20, 0x74, 0x6f, 0x20, 0x34, 0x30, 0x30, 0x0a, 0x09,
+  0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
+  0x30, 0x31, 0x32, 0x33, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x30, 0x31, 0x32, 0x33, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
+  0x73, 0x34, 0x35, 0x20, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x34, 0x35, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36,
+  0x20, 0x5e, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x31, 0x2e, 0x73, 0x36, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46,
+  0x46, 0x55, 0x4c, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x53, 0x6f, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a,
+  0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x3b, 0x20, 0x0a, 0x09, 0x09,
+  0x09, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73,
+  0x30, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x30, 0x2e, 0x73, 0x36, 0x37, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x32, 0x33, 0x20,
+  0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73,
+  0x36, 0x37, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x54, 0x72, 0x65, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x20, 0x3e,
+  0x3e, 0x20, 0x31, 0x36, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x20, 0x3c, 0x20, 0x28, 0x28, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x32, 0x20,
+  0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x29, 0x20, 0x3f, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x20, 0x3a, 0x20, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x32, 0x33,
+  0x30, 0x31, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x32, 0x20, 0x3d, 0x20,
+  0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73,
+  0x30, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29, 0x3b, 0x0a, 0x0a,
+  0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x69, 0x66, 0x20, 0x28, 0x67, 0x65,
+  0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28,
+  0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x66, 0x28, 0x22, 0x52, 0x32, 0x20, 0x6f, 0x75, 0x74, 0x3a,
+  0x20, 0x5c, 0x6e, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20,
+  0x25, 0x64, 0x20, 0x5c, 0x6e, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x28, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x20,
+  0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29,
+  0x2c, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
+  0x65, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x35, 0x29, 0x20,
+  0x26, 0x20, 0x30, 0x78, 0x37, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
+  0x65, 0x2e, 0x73, 0x31, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x29, 0x20,
+  0x3c, 0x3c, 0x20, 0x32, 0x33, 0x29, 0x2c, 0x20, 0x28, 0x28, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x3e,
+  0x3e, 0x20, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x29, 0x2c, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x3e, 0x3e,
+  0x20, 0x32, 0x37, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x68, 0x69, 0x66, 0x74, 0x69,
+  0x6e, 0x67, 0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6a, 0x75, 0x73, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64,
+  0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65,
+  0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36, 0x20, 0x26, 0x3d, 0x20,
+  0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65,
+  0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66,
+  0x74, 0x32, 0x34, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
+  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x53, 0x65,
+  0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x74, 0x72, 0x65, 0x65,
+  0x20, 0x28, 0x4c, 0x6f, 0x77, 0x20, 0x70, 0x61, 0x72, 0x74, 0x29, 0x0a,
+  0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
+  0x73, 0x35, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x20, 0x3c, 0x3c, 0x20, 0x35,
+  0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52,
+  0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e, 0x73, 0x30, 0x20, 0x3e,
+  0x3e, 0x20, 0x38, 0x29, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x74,
+  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x36, 0x20, 0x7c, 0x3d,
+  0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e,
+  0x73, 0x31, 0x20, 0x3c, 0x3c, 0x20, 0x34, 0x30, 0x29, 0x3b, 0x0a, 0x09,
+  0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
+  0x37, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72,
+  0x65, 0x65, 0x2e, 0x73, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x34, 0x29,
+  0x20, 0x7c, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65,
+  0x65, 0x2e, 0x73, 0x32, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x38, 0x29, 0x3b,
+  0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4d, 0x69, 0x78,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34,
+  0x0a, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
+  0x2e, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x72, 0x28,
+  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x29, 0x3b, 0x0a, 0x0a,
+  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x44, 0x72, 0x6f, 0x70, 0x20, 0x6f,
+  0x66, 0x20, 0x36, 0x34, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x61, 0x66,
+  0x74, 0x65, 0x72, 0x20, 0x6d, 0x69, 0x78, 0x0a, 0x09, 0x09, 0x09, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x34, 0x20, 0x26,
+  0x3d, 0x20, 0x30, 0x78, 0x30, 0x30, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c, 0x3b, 0x0a,
+  0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
+  0x73, 0x34, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52,
+  0x6f, 0x77, 0x30, 0x2e, 0x73, 0x35, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46,
+  0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x55, 0x4c, 0x29, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09,
+  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x35, 0x36,
+  0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
+  0x73, 0x36, 0x37, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20,
+  0x41, 0x64, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x69, 0x73, 0x73,
+  0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x74, 0x72,
+  0x65, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x28, 0x68, 0x69, 0x67,
+  0x68, 0x20, 0x68, 0x61, 0x6c, 0x66, 0x29, 0x0a, 0x09, 0x09, 0x09, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x37, 0x20, 0x3d,
+  0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54, 0x72, 0x65, 0x65, 0x2e,
+  0x73, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x36, 0x29, 0x3b, 0x0a, 0x09,
+  0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
+  0x37, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x54,
+  0x72, 0x65, 0x65, 0x2e, 0x73, 0x33, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x32,
+  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x42, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x20, 0x73, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34, 0x0a, 0x09, 0x09,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x20, 0x3d, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x73, 0x74,
+  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20,
+  0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74,
+  0x4f, 0x66, 0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x29,
+  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d,
+  0x69, 0x6e, 0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e,
+  0x74, 0x29, 0x20, 0x28, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
+  0x7a, 0x65, 0x2d, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x70,
+  0x6f, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x20, 0x2a, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a,
+  0x65, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x31, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
+  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x3b, 0x0a, 0x09, 0x09,
+  0x7d, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x7d, 0x0a, 0x0a, 0x0a, 0x2f, 0x2a,
+  0x0a, 0x09, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x34, 0x20, 0x0a, 0x09, 0x52,
+  0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x0a, 0x09, 0x57, 0x72, 0x69,
+  0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x66, 0x66,
+  0x65, 0x72, 0x30, 0x0a, 0x2a, 0x2f, 0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74,
+  0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65,
+  0x71, 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a,
+  0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f,
+  0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x68, 0x64, 0x73, 0x48, 0x61, 0x73, 0x68, 0x49, 0x49, 0x49, 0x5f,
+  0x52, 0x34, 0x20, 0x28, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+  0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73,
+  0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34,
+  0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f, 0x63,
+  0x68, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x65, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20,
+  0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f,
+  0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67,
+  0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a,
+  0x65, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x6c, 0x49, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65,
+  0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30,
+  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x73, 0x6b, 0x69, 0x70, 0x4f, 0x6e, 0x4e,
+  0x65, 0x77, 0x4a, 0x6f, 0x62, 0x28, 0x6c, 0x49, 0x64, 0x29, 0x3b, 0x0a,
   0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20,
   0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x26, 0x20,
   0x30, 0x78, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
@@ -1214,273 +1675,295 @@ unsigned char __hds_hash_III_cl[] = {
   0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67,
   0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29,
   0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76,
-  0x6f, 0x69, 0x64, 0x20, 0x62, 0x65, 0x61, 0x6d, 0x48, 0x61, 0x73, 0x68,
-  0x49, 0x49, 0x49, 0x5f, 0x52, 0x35, 0x20, 0x28, 0x09, 0x5f, 0x5f, 0x67,
-  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38,
-  0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a,
+  0x6f, 0x69, 0x64, 0x20, 0x68, 0x64, 0x73, 0x48, 0x61, 0x73, 0x68, 0x49,
+  0x49, 0x49, 0x5f, 0x52, 0x35, 0x20, 0x28, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20,
+  0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09,
+  0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a,
   0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75,
-  0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f,
-  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74,
-  0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-  0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73,
-  0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c,
-  0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x29,
-  0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75,
-  0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f,
-  0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b,
-  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x53, 0x69,
-  0x7a, 0x65, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20,
-  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33,
-  0x3b, 0x0a, 0x09, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3e,
-  0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x20, 0x3d, 0x20, 0x31,
-  0x36, 0x33, 0x38, 0x34, 0x3b, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66,
-  0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f,
+  0x74, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45,
+  0x70, 0x6f, 0x63, 0x68, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a,
+  0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x72, 0x6f,
+  0x75, 0x70, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x20,
+  0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f,
+  0x73, 0x69, 0x7a, 0x65, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x6c, 0x49, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69,
+  0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x73, 0x6b, 0x69, 0x70,
+  0x4f, 0x6e, 0x4e, 0x65, 0x77, 0x4a, 0x6f, 0x62, 0x28, 0x6c, 0x49, 0x64,
+  0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61,
+  0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74,
+  0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x3b, 0x0a, 0x09, 0x62, 0x75, 0x63,
+  0x6b, 0x65, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x3b, 0x0a, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x4f,
+  0x66, 0x73, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x33, 0x38, 0x34, 0x3b, 0x0a,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x20,
+  0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x4f, 0x66, 0x73, 0x2b, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63,
+  0x68, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x5b, 0x32, 0x35, 0x36, 0x30, 0x5d, 0x3b, 0x0a,
   0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x31, 0x30, 0x32, 0x34,
-  0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x32,
-  0x35, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x43, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f,
-  0x6e, 0x67, 0x32, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
-  0x73, 0x55, 0x4c, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x32, 0x20, 0x2a,
-  0x29, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x3b, 0x0a, 0x0a,
-  0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69,
-  0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69, 0x3c, 0x31, 0x30, 0x32, 0x34,
-  0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65,
-  0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b,
-  0x69, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a,
-  0x09, 0x7d, 0x20, 0x0a, 0x0a, 0x09, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
-  0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
-  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
-  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f,
-  0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49,
-  0x64, 0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20,
-  0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x69,
-  0x6e, 0x70, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
-  0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
-  0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20,
-  0x69, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
-  0x28, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e,
-  0x3e, 0x20, 0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x29,
-  0x20, 0x3d, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x7b, 0x0a,
-  0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x50, 0x6f,
-  0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69,
-  0x6e, 0x63, 0x28, 0x26, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e,
-  0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e,
-  0x50, 0x6f, 0x73, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20,
-  0x32, 0x35, 0x36, 0x30, 0x29, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x09, 0x09,
-  0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20,
-  0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e,
-  0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x65,
-  0x74, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x78,
-  0x63, 0x68, 0x67, 0x28, 0x26, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x73,
-  0x6c, 0x6f, 0x74, 0x5d, 0x2c, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x29,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x5b, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20,
-  0x72, 0x65, 0x74, 0x20, 0x7c, 0x20, 0x28, 0x69, 0x20, 0x3c, 0x3c, 0x20,
-  0x31, 0x36, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a,
-  0x0a, 0x09, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
-  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
-  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f,
-  0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49,
-  0x64, 0x3b, 0x20, 0x69, 0x3c, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x5b, 0x30, 0x5d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f,
-  0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75,
-  0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30,
-  0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e,
-  0x74, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d,
-  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x26, 0x20,
-  0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x77, 0x68,
-  0x69, 0x6c, 0x65, 0x20, 0x28, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65,
-  0x6d, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x29, 0x20,
-  0x7b, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x4c, 0x6f, 0x6f, 0x70,
-  0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
-  0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65,
-  0x6d, 0x50, 0x6f, 0x73, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6e, 0x65,
-  0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x5b, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d,
-  0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x20, 0x46, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x65,
-  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x75,
-  0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30,
-  0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74,
-  0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65,
-  0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c,
-  0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30, 0x29, 0x5d, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x31, 0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
-  0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x29, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69,
-  0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20,
-  0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x31, 0x29, 0x5d, 0x3b, 0x0a,
-  0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b,
-  0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73,
-  0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x75,
-  0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x0a, 0x09, 0x09,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46,
-  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c,
-  0x29, 0x20, 0x3d, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x31, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46,
-  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c,
-  0x29, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f,
-  0x20, 0x57, 0x65, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x73,
-  0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x21, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20,
+  0x74, 0x20, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x31, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x73, 0x20, 0x3d, 0x20, 0x26, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73,
+  0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x2a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x53, 0x6c, 0x6f, 0x74, 0x5d, 0x3b, 0x0a, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x32, 0x20,
+  0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x20,
+  0x3d, 0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x32, 0x20, 0x2a, 0x29, 0x20, 0x72, 0x65,
+  0x73, 0x75, 0x6c, 0x74, 0x73, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72,
+  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64,
+  0x3b, 0x20, 0x69, 0x3c, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x20, 0x69, 0x2b,
+  0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x69, 0x5d, 0x20, 0x3d,
+  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x7d, 0x20, 0x0a,
+  0x0a, 0x09, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x09, 0x62, 0x61,
+  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
+  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
+  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69,
+  0x3c, 0x69, 0x6e, 0x4c, 0x69, 0x6d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c,
+  0x6f, 0x63, 0x53, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d,
+  0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x69, 0x29, 0x5d, 0x3b,
+  0x0a, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x28, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32,
+  0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x29, 0x20, 0x3d, 0x3d, 0x20,
+  0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20, 0x3d, 0x20,
   0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26,
-  0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b,
-  0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x35, 0x36,
-  0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x29, 0x3b, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31,
-  0x20, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x35, 0x36, 0x28, 0x73,
-  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x29, 0x3b, 0x0a, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x6d, 0x61, 0x6c,
-  0x6c, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x31, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31,
-  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x20, 0x3c, 0x20, 0x28, 0x73,
-  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x20, 0x26,
-  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3b,
-  0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x73, 0x6d, 0x61,
-  0x6c, 0x6c, 0x65, 0x72, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09,
-  0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x5e, 0x3d,
-  0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x3b, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31,
-  0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
-  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x30, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x09, 0x0a,
+  0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d,
+  0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x20,
+  0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x2c,
+  0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x32, 0x35, 0x36, 0x30,
+  0x29, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29,
+  0x20, 0x26, 0x20, 0x30, 0x78, 0x33, 0x46, 0x46, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20,
+  0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28,
+  0x26, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d,
+  0x2c, 0x20, 0x69, 0x6e, 0x50, 0x6f, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09,
+  0x09, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69,
+  0x6e, 0x50, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x72, 0x65, 0x74, 0x20,
+  0x7c, 0x20, 0x28, 0x69, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29, 0x3b,
+  0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x0a, 0x09, 0x62, 0x61,
+  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
+  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
+  0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x6c, 0x49, 0x64, 0x3b, 0x20, 0x69,
+  0x3c, 0x69, 0x6e, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30,
+  0x5d, 0x3b, 0x20, 0x69, 0x2b, 0x3d, 0x6c, 0x6f, 0x63, 0x53, 0x69, 0x7a,
+  0x65, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73, 0x30, 0x20, 0x3d, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x36, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6e, 0x65,
+  0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x5b, 0x69, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46,
+  0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20,
+  0x28, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x20, 0x21, 0x3d,
+  0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09,
+  0x09, 0x2f, 0x2f, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x74, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75,
+  0x67, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x09, 0x09, 0x09,
+  0x75, 0x69, 0x6e, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f, 0x73,
+  0x31, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x6e, 0x65,
+  0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x36, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6e, 0x65, 0x78, 0x74, 0x45, 0x6c,
+  0x65, 0x6d, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x6e,
+  0x65, 0x78, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x5d, 0x20, 0x26, 0x20, 0x30,
+  0x78, 0x46, 0x46, 0x46, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f,
+  0x20, 0x46, 0x65, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x3d,
+  0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d, 0x61, 0x64,
+  0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x50, 0x6f,
+  0x73, 0x30, 0x29, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f,
+  0x6e, 0x67, 0x38, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31,
+  0x20, 0x3d, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x5b, 0x6d,
+  0x61, 0x64, 0x32, 0x34, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20,
+  0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d,
+  0x50, 0x6f, 0x73, 0x31, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09,
+  0x2f, 0x2f, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x69, 0x66, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x6d, 0x61, 0x74,
+  0x63, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
+  0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c, 0x29, 0x20, 0x3d, 0x3d,
+  0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73,
+  0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x55, 0x4c, 0x29, 0x29, 0x20, 0x7b,
+  0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x20, 0x57, 0x65, 0x20,
+  0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x73, 0x6f, 0x6c, 0x75, 0x74,
+  0x69, 0x6f, 0x6e, 0x21, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d,
+  0x69, 0x63, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x72, 0x65, 0x73, 0x75,
+  0x6c, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x20, 0x3e, 0x3d, 0x20,
+  0x6d, 0x61, 0x78, 0x53, 0x6f, 0x6c, 0x73, 0x29, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x09, 0x2f, 0x2f, 0x20, 0x44, 0x6f,
+  0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x77, 0x72, 0x69,
+  0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20,
+  0x73, 0x6c, 0x6f, 0x74, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74,
+  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x69,
+  0x66, 0x74, 0x35, 0x36, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x30, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+  0x35, 0x36, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x29,
+  0x3b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+  0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x28, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x30, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x20,
+  0x3c, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e,
+  0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x29, 0x20, 0x7b, 0x0a,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x30, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x31, 0x20, 0x5e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x20, 0x5e, 0x3d, 0x20, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x3b, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x7d, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73,
+  0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38,
+  0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x30, 0x5d, 0x20, 0x3d, 0x20,
+  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x31,
+  0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c,
+  0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70,
+  0x6f, 0x73, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74,
+  0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x32, 0x33, 0x3b, 0x20,
   0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73,
   0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73,
-  0x20, 0x2b, 0x20, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70,
-  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x31, 0x3b, 0x20, 0x0a, 0x09,
+  0x20, 0x2b, 0x20, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70,
+  0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x34, 0x35, 0x3b, 0x20, 0x0a, 0x09,
   0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c,
   0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b,
-  0x20, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
-  0x77, 0x30, 0x2e, 0x73, 0x32, 0x33, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09,
-  0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31,
-  0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x32,
-  0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
-  0x2e, 0x73, 0x34, 0x35, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72,
-  0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b,
-  0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x33, 0x5d, 0x20,
-  0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73,
-  0x36, 0x37, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65,
+  0x20, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f,
+  0x77, 0x30, 0x2e, 0x73, 0x36, 0x37, 0x3b, 0x20, 0x0a, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b,
+  0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20,
+  0x34, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x31, 0x2e, 0x73, 0x30, 0x31, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09,
+  0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20,
+  0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x35, 0x5d,
+  0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e,
+  0x73, 0x32, 0x33, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65,
   0x73, 0x75, 0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20,
-  0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x34, 0x5d, 0x20, 0x3d,
-  0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x30,
-  0x31, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75,
+  0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x36, 0x5d, 0x20, 0x3d,
+  0x20, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x34,
+  0x35, 0x3b, 0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75,
   0x6c, 0x74, 0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a,
-  0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x73,
-  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x32, 0x33, 0x3b,
-  0x20, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
-  0x73, 0x55, 0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f,
-  0x73, 0x20, 0x2b, 0x20, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65,
-  0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x34, 0x35, 0x3b, 0x20, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x55,
-  0x4c, 0x5b, 0x31, 0x20, 0x2b, 0x20, 0x38, 0x2a, 0x70, 0x6f, 0x73, 0x20,
-  0x2b, 0x20, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x52,
-  0x6f, 0x77, 0x31, 0x2e, 0x73, 0x36, 0x37, 0x3b, 0x20, 0x0a, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x2f, 0x2f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28,
-  0x22, 0x47, 0x50, 0x55, 0x3a, 0x20, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20,
-  0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20,
-  0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30,
-  0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
-  0x29, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x28, 0x28,
-  0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30, 0x2e, 0x73, 0x30, 0x20,
-  0x3e, 0x3e, 0x20, 0x32, 0x35, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31,
-  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09,
-  0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x20, 0x0a, 0x7d,
-  0x0a, 0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-  0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71, 0x64, 0x5f, 0x77, 0x6f,
-  0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5f, 0x73, 0x69, 0x7a,
-  0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x31, 0x2c,
-  0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72, 0x6e,
-  0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x77, 0x61, 0x74, 0x63,
-  0x68, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x20, 0x20,
-  0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
-  0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66,
-  0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67,
-  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38,
-  0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x31, 0x2c, 0x0a,
-  0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x2c, 0x0a, 0x09,
-  0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x34, 0x20, 0x70, 0x72,
-  0x65, 0x50, 0x6f, 0x77, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29,
-  0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x75,
-  0x6d, 0x3d, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
-  0x6d, 0x69, 0x6e, 0x65, 0x3d, 0x28, 0x31, 0x20, 0x3c, 0x3c, 0x20, 0x32,
-  0x34, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x6d,
-  0x61, 0x78, 0x65, 0x3d, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x09,
-  0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d,
-  0x30, 0x3b, 0x20, 0x69, 0x3c, 0x34, 0x30, 0x39, 0x36, 0x3b, 0x20, 0x69,
-  0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x75, 0x6d,
-  0x20, 0x2b, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73,
-  0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2b, 0x69, 0x5d, 0x3b, 0x09, 0x0a,
-  0x09, 0x09, 0x09, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x69,
-  0x6e, 0x28, 0x6d, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2b, 0x69,
-  0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x78, 0x65, 0x20,
-  0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x6d, 0x61, 0x78, 0x65, 0x2c, 0x20,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33,
-  0x38, 0x34, 0x2b, 0x69, 0x5d, 0x29, 0x3b, 0x09, 0x0a, 0x09, 0x09, 0x09,
-  0x2f, 0x2f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x25, 0x64,
-  0x20, 0x25, 0x64, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x69, 0x2c, 0x20,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x29,
-  0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x69, 0x66, 0x20,
-  0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d,
-  0x20, 0x3c, 0x20, 0x31, 0x33, 0x30, 0x30, 0x30, 0x29, 0x20, 0x70, 0x72,
-  0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20,
-  0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x69, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x29, 0x3b, 0x09, 0x0a, 0x09,
-  0x09, 0x09, 0x2f, 0x2f, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x20, 0x31, 0x36,
-  0x30, 0x30, 0x30, 0x29, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28,
-  0x22, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20,
-  0x69, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b,
-  0x69, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x70,
-  0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x73, 0x3a, 0x20, 0x25, 0x75, 0x20, 0x25, 0x75, 0x20, 0x25,
-  0x75, 0x20, 0x25, 0x75, 0x20, 0x25, 0x75, 0x20, 0x7c, 0x20, 0x25, 0x75,
-  0x20, 0x25, 0x75, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x28, 0x75, 0x69,
-  0x6e, 0x74, 0x29, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2e, 0x73,
-  0x30, 0x2c, 0x20, 0x73, 0x75, 0x6d, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2b, 0x30,
-  0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b,
-  0x31, 0x36, 0x33, 0x38, 0x34, 0x2b, 0x31, 0x5d, 0x2c, 0x20, 0x63, 0x6f,
+  0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x73,
+  0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x31, 0x2e, 0x73, 0x36, 0x37, 0x3b,
+  0x20, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x70, 0x72, 0x69,
+  0x6e, 0x74, 0x66, 0x28, 0x22, 0x47, 0x50, 0x55, 0x3a, 0x20, 0x25, 0x64,
+  0x20, 0x25, 0x64, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x28, 0x75, 0x69,
+  0x6e, 0x74, 0x29, 0x20, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77,
+  0x30, 0x2e, 0x73, 0x30, 0x20, 0x26, 0x20, 0x30, 0x78, 0x31, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x29, 0x2c, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74,
+  0x29, 0x20, 0x28, 0x28, 0x73, 0x74, 0x65, 0x70, 0x52, 0x6f, 0x77, 0x30,
+  0x2e, 0x73, 0x30, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x35, 0x29, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x31, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x29, 0x29,
+  0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09,
+  0x7d, 0x20, 0x0a, 0x7d, 0x0a, 0x0a, 0x5f, 0x5f, 0x61, 0x74, 0x74, 0x72,
+  0x69, 0x62, 0x75, 0x74, 0x65, 0x5f, 0x5f, 0x28, 0x28, 0x72, 0x65, 0x71,
+  0x64, 0x5f, 0x77, 0x6f, 0x72, 0x6b, 0x5f, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x77, 0x67, 0x53, 0x69, 0x7a, 0x65,
+  0x2c, 0x20, 0x31, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x5f, 0x5f,
+  0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x77, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x20, 0x20, 0x20, 0x20, 0x28, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x30, 0x2c, 0x0a, 0x09, 0x09, 0x09,
+  0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x6c,
+  0x6f, 0x6e, 0x67, 0x38, 0x20, 0x2a, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+  0x72, 0x31, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+  0x73, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x6c, 0x6f, 0x6e, 0x67,
+  0x34, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77, 0x2c, 0x0a, 0x09, 0x09,
+  0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c,
+  0x0a, 0x09, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6a, 0x6f, 0x62, 0x45, 0x70, 0x6f,
+  0x63, 0x68, 0x2c, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x65, 0x70, 0x6f, 0x63, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x0a, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x20, 0x3d, 0x3d, 0x20,
+  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x75, 0x6d, 0x3d, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e,
+  0x74, 0x20, 0x6d, 0x69, 0x6e, 0x65, 0x3d, 0x28, 0x31, 0x20, 0x3c, 0x3c,
+  0x20, 0x32, 0x34, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x6d, 0x61, 0x78, 0x65, 0x3d, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x0a,
+  0x09, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20,
+  0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x3c, 0x34, 0x30, 0x39, 0x36, 0x3b,
+  0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x73,
+  0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2b, 0x69, 0x5d, 0x3b,
+  0x09, 0x0a, 0x09, 0x09, 0x09, 0x6d, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20,
+  0x6d, 0x69, 0x6e, 0x28, 0x6d, 0x69, 0x6e, 0x65, 0x2c, 0x20, 0x63, 0x6f,
   0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34,
-  0x2b, 0x34, 0x30, 0x39, 0x35, 0x5d, 0x2c, 0x20, 0x6d, 0x69, 0x6e, 0x65,
-  0x2c, 0x20, 0x6d, 0x61, 0x78, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a,
-  0x0a, 0x7d, 0x0a, 0x0a
+  0x2b, 0x69, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x6d, 0x61, 0x78,
+  0x65, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x6d, 0x61, 0x78, 0x65,
+  0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31,
+  0x36, 0x33, 0x38, 0x34, 0x2b, 0x69, 0x5d, 0x29, 0x3b, 0x09, 0x0a, 0x09,
+  0x09, 0x09, 0x2f, 0x2f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22,
+  0x25, 0x64, 0x20, 0x25, 0x64, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x69,
+  0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69,
+  0x5d, 0x29, 0x3b, 0x09, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x69,
+  0x66, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b,
+  0x69, 0x5d, 0x20, 0x3c, 0x20, 0x31, 0x33, 0x30, 0x30, 0x30, 0x29, 0x20,
+  0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x25, 0x64, 0x20, 0x25,
+  0x64, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x69, 0x2c, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x29, 0x3b, 0x09,
+  0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x20,
+  0x31, 0x36, 0x30, 0x30, 0x30, 0x29, 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74,
+  0x66, 0x28, 0x22, 0x25, 0x64, 0x20, 0x25, 0x64, 0x20, 0x5c, 0x6e, 0x22,
+  0x2c, 0x20, 0x69, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x5b, 0x69, 0x5d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09,
+  0x09, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x28, 0x22, 0x43, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x73, 0x3a, 0x20, 0x25, 0x75, 0x20, 0x25, 0x75,
+  0x20, 0x25, 0x75, 0x20, 0x25, 0x75, 0x20, 0x25, 0x75, 0x20, 0x7c, 0x20,
+  0x25, 0x75, 0x20, 0x25, 0x75, 0x20, 0x5c, 0x6e, 0x22, 0x2c, 0x20, 0x28,
+  0x75, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x70, 0x72, 0x65, 0x50, 0x6f, 0x77,
+  0x2e, 0x73, 0x30, 0x2c, 0x20, 0x73, 0x75, 0x6d, 0x2c, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34,
+  0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x73, 0x5b, 0x31, 0x36, 0x33, 0x38, 0x34, 0x2b, 0x31, 0x5d, 0x2c, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x31, 0x36, 0x33,
+  0x38, 0x34, 0x2b, 0x34, 0x30, 0x39, 0x35, 0x5d, 0x2c, 0x20, 0x6d, 0x69,
+  0x6e, 0x65, 0x2c, 0x20, 0x6d, 0x61, 0x78, 0x65, 0x29, 0x3b, 0x0a, 0x09,
+  0x7d, 0x0a, 0x0a, 0x7d, 0x0a, 0x0a
 };
-unsigned int __hds_hash_III_cl_len = 17788;
+unsigned int __hds_hash_III_cl_len = 23586;
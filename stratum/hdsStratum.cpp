@@ -5,7 +5,7 @@
 
 
 #include "hdsStratum.h"
-#include "crypto/sha256.c"
+#include "crypto/sha256.h"
 #include "crypto/blake2b.h"
 
 #ifdef __APPLE__
@@ -16,41 +16,24 @@
 namespace hdsMiner {
 
 // This one ensures that the calling thread can work on immediately
-void hdsStratum::queueDataSend(string data) {
-	io_service.post(boost::bind(&hdsStratum::syncSend,this, data));
+void hdsStratum::queueDataSend(uint32_t pool, string data) {
+	io_service.post(boost::bind(&hdsStratum::sendShare,this, pool, data));
 }
 
-// Function to add a string into the socket write queue
-void hdsStratum::syncSend(string data) {
-	writeRequests.push_back(data);
-	activateWrite();
-}
-
-
-// Got granted we can write to our connection, lets do so	
-void hdsStratum::activateWrite() {
-	if (!activeWrite && writeRequests.size() > 0) {
-		activeWrite = true;
 
-		string json = writeRequests.front();
-		writeRequests.pop_front();
+// Shares go to the pool of their job, if it is not connected they wait for its next login
+void hdsStratum::sendShare(uint32_t pool, string data) {
+	poolSession &session = *sessions[pool];
 
-		std::ostream os(&requestBuffer);
-		os << json;
-		if (debug) cout << "Write to connection: " << json;
-
-		boost::asio::async_write(*socket, requestBuffer, boost::bind(&hdsStratum::writeHandler,this, boost::asio::placeholders::error));
+	if (!session.loggedIn) {
+		if (pendingShares.size() < maxPendingShares) pendingShares.push_back(std::make_pair(pool, data));
+		HDS_LOG(logInfo) << "No connection to " << poolName(pool) << ", solution will be submitted after reconnect";
+		return;
 	}
-}
-	
 
-// Once written check if there is more to write
-void hdsStratum::writeHandler(const boost::system::error_code& err) {
-	activeWrite = false;
-	activateWrite(); 
-	if (err) {
-		if (debug) cout << "Write to stratum failed: " << err.message() << endl;
-	} 
+	session.requestSent.push_back(std::chrono::steady_clock::now());
+	capture.record(pool, true, data);
+	session.connection->send(data);
 }
 
 
@@ -60,81 +43,113 @@ void hdsStratum::startWorking(){
 	std::thread (&hdsStratum::connect,this).detach();
 }
 
-// This function will be used to establish a connection to the API server
+// Thread function of the stratum client. Connecting, reconnecting and all traffic run as
+// asynchronous operations of io_service, so run() only returns on an exception.
 void hdsStratum::connect() {
-	while (true) {
-		tcp::resolver::query q(host, port); 
+	boost::asio::io_service::work keepRunning(io_service);
+	traceThreadName("Stratum");
+	for (auto &session : sessions) session->connection->start();
 
-		cout << "Connecting to " << host << ":" << port << endl;
-		try {
-	    		tcp::resolver::iterator endpoint_iterator = res.resolve(q);
-			tcp::endpoint endpoint = *endpoint_iterator;
-			socket.reset(new boost::asio::ssl::stream<tcp::socket>(io_service, context));
-
-			socket->set_verify_mode(boost::asio::ssl::verify_none);
-    			socket->set_verify_callback(boost::bind(&hdsStratum::verifyCertificate, this, _1, _2));
-
-			socket->lowest_layer().async_connect(endpoint,
-			boost::bind(&hdsStratum::handleConnect, this, boost::asio::placeholders::error, ++endpoint_iterator));
+	if (sessions.size() > 1) handlePolicyTimer(boost::system::error_code());
 
+	while (true) {
+		try {
 			io_service.run();
 		} catch (std::exception const& _e) {
-			 cout << "Stratum error: " <<  _e.what() << endl;
+			HDS_LOG(logError) << "Stratum error: " <<  _e.what();
 		}
 
-		workId = -1;
 		io_service.reset();
-		socket->lowest_layer().close();
+		sessions[active]->connection->close("stratum error");
+	}		
+}
 
-		cout << "Lost connection to HDS stratum server" << endl;
-		cout << "Trying to connect in 5 seconds"<< endl;
 
-		std::this_thread::sleep_for(std::chrono::seconds(5));
-	}		
+// The TLS connection is up, log in
+void hdsStratum::handleConnected(uint32_t pool) {
+	std::stringstream json;
+	json << "{\"method\":\"login\", \"api_key\":\"" << apiKey << "\", \"id\":\"login\",\"jsonrpc\":\"2.0\"} \n";
+	sessions[pool]->requestSent.assign(1, std::chrono::steady_clock::now());
+
+	// The key does not belong into a capture that may be shared
+	if (capture.isOpen()) capture.record(pool, true, "{\"method\":\"login\", \"api_key\":\"*\", \"id\":\"login\",\"jsonrpc\":\"2.0\"}");
+	sessions[pool]->connection->send(json.str());	
 }
 
 
-// Once the physical connection is there start a TLS handshake
-void hdsStratum::handleConnect(const boost::system::error_code& err, tcp::resolver::iterator endpoint_iterator) {
-	if (!err) {
-	cout << "Node connection: ok" << endl;
+// Messages for the old connection are lost, the connection retries by itself.
+// Losing the active pool switches to a standby, without one the grace period starts.
+void hdsStratum::handleDisconnected(uint32_t pool) {
+	poolSession &session = *sessions[pool];
+	session.loggedIn = false;
+	session.lastJob.reset();
+	session.requestSent.clear();
 
-      	// The connection was successful. Do the TLS handshake
-	socket->async_handshake(boost::asio::ssl::stream_base::client,boost::bind(&hdsStratum::handleHandshake, this, boost::asio::placeholders::error));
-	
-    	} else if (err != boost::asio::error::operation_aborted) {
-		if (endpoint_iterator != tcp::resolver::iterator()) {
-			// The endpoint did not work, but we can try the next one
-			tcp::endpoint endpoint = *endpoint_iterator;
+	if (pool != active) return;
 
-			socket->lowest_layer().async_connect(endpoint,
-			boost::bind(&hdsStratum::handleConnect, this, boost::asio::placeholders::error, ++endpoint_iterator));
-		} 
-	} 	
+	HDS_LOG(logInfo) << "Lost connection to HDS stratum server";
+	checkFailover();
+	if (pool == active) startGracePeriod();
 }
 
 
-// Dummy function: we will not verify if the endpoint is verified at the moment,
-// still there is a TLS handshake, so connection is encrypted
-bool hdsStratum::verifyCertificate(bool preverified, boost::asio::ssl::verify_context& ctx){
-	return true;
+// On a lost connection the GPUs keep mining the last job for a while, the shares they find
+// are submitted after the next login. Once the grace period is over the GPUs pause.
+void hdsStratum::startGracePeriod() {
+	if (inGracePeriod) {
+		// Still within the grace period from an earlier attempt, rearm the timer for the rest of it
+		endGracePeriod(boost::system::error_code());
+		return;
+	}
+
+	if ((config.reconnectGraceSec == 0) || !hasWork()) {
+		publishJob(std::make_shared<JobSnapshot>());
+		return;
+	}
+
+	inGracePeriod = true;
+	disconnectedAt = std::chrono::steady_clock::now();
+	HDS_LOG(logInfo) << "Continue mining job " << currentJob.load()->workId << " for up to " << config.reconnectGraceSec << " seconds while reconnecting";
+
+	endGracePeriod(boost::system::error_code());
 }
 
 
-void hdsStratum::handleHandshake(const boost::system::error_code& error) {
-	if (!error) {
-		// Listen to receive stratum input
-		boost::asio::async_read_until(*socket, responseBuffer, "\n",
-		boost::bind(&hdsStratum::readStratum, this, boost::asio::placeholders::error));
+// Timer handler, called from the stratum thread only
+void hdsStratum::endGracePeriod(const boost::system::error_code& err) {
+	if (err || !inGracePeriod) return;
 
-		cout << "TLS Handshake:   ok" << endl;
-		
-		// The connection was successful. Send the login request
-		std::stringstream json;
-		json << "{\"method\":\"login\", \"api_key\":\"" << apiKey << "\", \"id\":\"login\",\"jsonrpc\":\"2.0\"} \n";
-		queueDataSend(json.str());	
-	} else {
-		cout << "Handshake failed: " << error.message() << "\n";
+	auto graceEnd = disconnectedAt + std::chrono::seconds(config.reconnectGraceSec);
+	if (std::chrono::steady_clock::now() >= graceEnd) {
+		inGracePeriod = false;
+		HDS_LOG(logInfo) << "No connection to the stratum server for " << config.reconnectGraceSec << " seconds, pausing the GPUs";
+		publishJob(std::make_shared<JobSnapshot>());
+		pendingShares.clear();
+		return;
+	}
+
+	graceTimer.expires_at(graceEnd);
+	graceTimer.async_wait(boost::bind(&hdsStratum::endGracePeriod, this, boost::asio::placeholders::error));
+}
+
+
+// Send the shares found while the pool had no connection
+void hdsStratum::flushPendingShares(uint32_t pool) {
+	std::deque< std::pair<uint32_t, string> > others;
+	uint32_t flushed = 0;
+
+	for (auto &share : pendingShares) {
+		if (share.first == pool) {
+			sendShare(pool, share.second);
+			flushed++;
+		} else {
+			others.push_back(share);
+		}
+	}
+	pendingShares.swap(others);
+
+	if (flushed > 0) {
+		HDS_LOG(logInfo) << "Submitted " << flushed << " solutions found while disconnected";
 	}
 }
 
@@ -153,185 +168,697 @@ vector<uint8_t> parseHex (string input) {
 }
 
 
-// Main stratum read function, will be called on every received data
-void hdsStratum::readStratum(const boost::system::error_code& err) {
-	if (!err) {
-		// We just read something without problem.
-		std::istream is(&responseBuffer);
-		std::string response;
-		getline(is, response);
+// Main stratum read function, will be called on every received line
+void hdsStratum::readStratum(uint32_t pool, const string& response) {
+	poolSession &session = *sessions[pool];
+	auto now = std::chrono::steady_clock::now();
+	capture.record(pool, false, response);
 
-		if (debug) cout << "Incomming Stratum: " << response << endl;
+	HDS_LOG(logDebug) << "Incomming Stratum (" << poolName(pool) << "): " << response;
 
-		// Parse the input to a property tree
-		pt::iptree jsonTree;
-		try {
-			istringstream jsonStream(response);
-			pt::read_json(jsonStream,jsonTree);
+	// Parse the input to a property tree
+	pt::iptree jsonTree;
+	try {
+		istringstream jsonStream(response);
+		pt::read_json(jsonStream,jsonTree);
 
-			// This should be for any valid stratum
-			if (jsonTree.count("method") > 0) {	
-				string method = jsonTree.get<string>("method");
-			
-				// Result to a node request
-				if (method.compare("result") == 0) {
-					// A login reply
-					if (jsonTree.get<string>("id").compare("login") == 0) {
-						int32_t code = jsonTree.get<int32_t>("code");
-						if (code >= 0) {
-							cout << "Login at node accepted \n" << endl;
-							if (jsonTree.count("nonceprefix") > 0) {
-								string poolNonceStr = jsonTree.get<string>("nonceprefix");
-								poolNonce = parseHex(poolNonceStr);
-							} else {
-								poolNonce.clear();
-							}
-
-							if (jsonTree.count("forkheight") > 0) {
-								forkHeight = jsonTree.get<uint64_t>("forkheight");
-							}
-
-							if (jsonTree.count("forkheight2") > 0) {
-								forkHeight2 = jsonTree.get<uint64_t>("forkheight2");
-							}
-						} else {
-							cout << "Error: Login at node not accepted. Closing miner." << endl;
-							exit(0);
-						}	
-					} else {	// A share reply
-						int32_t code = jsonTree.get<int32_t>("code");
-						if (code == 1) {
-							cout << "Solution for work id " << jsonTree.get<string>("id") << " accepted" << endl;
-							sharesAcc++;
+		// This should be for any valid stratum
+		if (jsonTree.count("method") > 0) {	
+			string method = jsonTree.get<string>("method");
+		
+			// Result to a node request
+			if (method.compare("result") == 0) {
+				// Requests are answered in order, the answer time gives the round trip time
+				if (session.requestSent.size() > 0) {
+					double rtt = std::chrono::duration<double, std::milli>(now - session.requestSent.front()).count();
+					session.rttMs = (session.rttMs == 0) ? rtt : 0.8 * session.rttMs + 0.2 * rtt;
+					session.requestSent.pop_front();
+				}
+
+				// A login reply
+				if (jsonTree.get<string>("id").compare("login") == 0) {
+					int32_t code = jsonTree.get<int32_t>("code");
+					if (code >= 0) {
+						HDS_LOG(logInfo) << "Login at node accepted";
+						session.connection->loginDone();
+						session.loggedIn = true;
+						session.loginTime = now;
+						if ((pool == active) && inGracePeriod) {
+							inGracePeriod = false;
+							graceTimer.cancel();
+						}
+						flushPendingShares(pool);
+						if (jsonTree.count("nonceprefix") > 0) {
+							string poolNonceStr = jsonTree.get<string>("nonceprefix");
+							session.poolNonce = parseHex(poolNonceStr);
 						} else {
-							cout << "Warning: Solution for work id " << jsonTree.get<string>("id") << " rejected" << endl;
-							sharesRej++;
+							session.poolNonce.clear();
+						}
+
+						if (jsonTree.count("forkheight") > 0) {
+							session.forkHeight = jsonTree.get<uint64_t>("forkheight");
 						}
+
+						if (jsonTree.count("forkheight2") > 0) {
+							session.forkHeight2 = jsonTree.get<uint64_t>("forkheight2");
+						}
+					} else {
+						HDS_LOG(logError) << "Error: Login at node not accepted. Closing miner.";
+						exit(0);
+					}	
+				} else {	// A share reply
+					int32_t code = jsonTree.get<int32_t>("code");
+					if (code == 1) {
+						HDS_LOG(logInfo) << "Solution for work id " << jsonTree.get<string>("id") << " accepted";
+					} else {
+						HDS_LOG(logWarning) << "Warning: Solution for work id " << jsonTree.get<string>("id") << " rejected";
 					}
+					if (traceEnabled()) traceInstant((code == 1) ? "share accepted" : "share rejected", "stratum", "\"workId\":" + to_string(jsonTree.get<int64_t>("id", -1)) + ",\"pool\":" + to_string(pool));
+					recordShareResult(pool, jsonTree.get<int64_t>("id", -1), (code == 1));
+					if (shareListener) shareListener(pool, jsonTree.get<int64_t>("id", -1), (code == 1));
 				}
+			}
 
-				// A new job decription;
-				if (method.compare("job") == 0) {
-					updateMutex.lock();
-					// Get new work load
-					string work = jsonTree.get<string>("input");
-					serverWork = parseHex(work);
-
-					// Get jobId of new job
-					workId =  jsonTree.get<uint64_t>("id");	
-					
-					// Get the target difficulty
-					uint32_t stratDiff =  jsonTree.get<uint32_t>("difficulty");
-					powDiff = hds::Difficulty(stratDiff);
-
-					// Nicehash support
-					if (jsonTree.count("nonceprefix") > 0) {
-						string poolNonceStr = jsonTree.get<string>("nonceprefix");
-						poolNonce = parseHex(poolNonceStr);
-					}
+			// A new job decription;
+			if (method.compare("job") == 0) {
+				std::shared_ptr<JobSnapshot> job = std::make_shared<JobSnapshot>();
+
+				// Get new work load
+				string work = jsonTree.get<string>("input");
+				vector<uint8_t> serverWork = parseHex(work);
+				serverWork.resize(32, 0);
+				memcpy(job->work, serverWork.data(), 32);
+
+				// Get jobId of new job
+				job->workId =  jsonTree.get<uint64_t>("id");
+				
+				// Get the target difficulty
+				uint32_t stratDiff =  jsonTree.get<uint32_t>("difficulty");
+				job->powDiff = hds::Difficulty(stratDiff);
+				job->powDiff.GetTarget(job->powTarget);
+
+				// Nicehash support
+				if (jsonTree.count("nonceprefix") > 0) {
+					string poolNonceStr = jsonTree.get<string>("nonceprefix");
+					session.poolNonce = parseHex(poolNonceStr);
+				}
 
-					// Block Height for fork detection
-					if (jsonTree.count("height") > 0) {
-						blockHeight = jsonTree.get<uint64_t>("height");
-						if ((blockHeight == forkHeight) || (blockHeight == forkHeight2)) cout << endl << "-= PoW fork height reached. Switching algorithm =-" << endl << endl;
+				// Block Height for fork detection
+				if (jsonTree.count("height") > 0) {
+					session.blockHeight = jsonTree.get<uint64_t>("height");
+					if ((pool == active) && ((session.blockHeight == session.forkHeight) || (session.blockHeight == session.forkHeight2))) {
+						HDS_LOG(logInfo) << "-= PoW fork height reached. Switching algorithm =-";
 					}
+					trackJobDelay(pool, session.blockHeight);
+				}
 
+				job->poolNonceBytes = min<uint32_t>(session.poolNonce.size(), 6); 	// Need some range left for miner
+				memcpy(job->poolNonce, session.poolNonce.data(), job->poolNonceBytes);
+				job->solver = selectSolver(session);
+				job->nextSolver = upcomingSolver(session, job->solver);
+				job->pool = pool;
+				if (traceEnabled()) traceInstant("job", "stratum", "\"workId\":" + to_string(job->workId) + ",\"pool\":" + to_string(pool) + ",\"active\":" + ((pool == active) ? "true" : "false"));
+				if (session.blockHeight != numeric_limits<uint64_t>::max()) job->height = session.blockHeight;
 
-					updateMutex.unlock();	
+				session.lastJob = job;
 
-					cout << "New job: " << workId << "  Difficulty: " << std::fixed << std::setprecision(0) << powDiff.ToFloat() << endl;
-					cout << "Solutions (Accepted/Rejected): " << sharesAcc << " / " << sharesRej << " Uptime: " << (int)(t_current-t_start) << " sec" << endl; 	
+				if (pool == active) {
+					publishJob(job);
+
+					HDS_LOG(logInfo) << "New job: " << job->workId << "  Difficulty: " << logPrecision(0) << job->powDiff.ToFloat();
+					if (job->nextSolver != None) {
+						uint64_t fork = (job->nextSolver == HdsII) ? session.forkHeight : session.forkHeight2;
+						uint64_t blocks = fork - session.blockHeight;
+						HDS_LOG(logInfo) << "PoW fork in " << blocks << ((blocks == 1) ? " block" : " blocks") << ", preparing the next solver";
+					}
+					HDS_LOG(logInfo) << "Solutions (Accepted/Rejected/Stale): " << sharesAcc << " / " << sharesRej << " / " << sharesStale << " Uptime: " << (int)(t_current-t_start) << " sec"
+					                 << " Round trip: " << logPrecision(1) << session.rttMs << " ms";
+				} else {
+					HDS_LOG(logDebug) << "Standby job " << job->workId << " from " << poolName(pool);
 				}
 
-				// Cancel a running job
-				if (method.compare("cancel") == 0) {
-					updateMutex.lock();
-					// Get jobId of canceled job
-					uint64_t id =  jsonTree.get<uint64_t>("id");
-					// Set it to an unlikely value;
-					if (id == workId) workId = -1;
-					updateMutex.unlock();
+				checkFailover();
+			}
+
+			// Cancel a running job
+			if (method.compare("cancel") == 0) {
+				// Get jobId of canceled job
+				int64_t id =  jsonTree.get<uint64_t>("id");
+				if (session.lastJob && (id == session.lastJob->workId)) session.lastJob.reset();
+
+				// Replace it by a job with an unlikely id, so the GPUs pause
+				if ((pool == active) && (id == currentJob.load()->workId)) {
+					recordJob(std::make_shared<JobSnapshot>(), true);
+					publishJob(std::make_shared<JobSnapshot>());
 				}
-				t_current = time(NULL);
 			}
+			t_current = time(NULL);
+		}
+
+		
+
+	} catch(const pt::ptree_error &e) {
+		HDS_LOG(logError) << "Json parse error when reading Stratum node: " << e.what();
+	}
+}
 
-			
 
-		} catch(const pt::ptree_error &e) {
-			cout << "Json parse error when reading Stratum node: " << e.what() << endl; 
+// Remember when a block height was first announced by any pool, the pools that announce it
+// later get the difference added to their smoothed job delay
+void hdsStratum::trackJobDelay(uint32_t pool, uint64_t height) {
+	if (sessions.size() < 2) return;
+
+	auto now = std::chrono::steady_clock::now();
+	auto seen = heightSeen.find(height);
+	if (seen == heightSeen.end()) {
+		heightSeen[height] = now;
+		while (heightSeen.size() > 16) heightSeen.erase(heightSeen.begin());
+		seen = heightSeen.find(height);
+	}
+
+	double delay = std::chrono::duration<double, std::milli>(now - seen->second).count();
+	sessions[pool]->jobDelayMs = 0.8 * sessions[pool]->jobDelayMs + 0.2 * delay;
+}
+
+
+// Job delay of a pool, including the time it is behind on the newest block height right now
+double hdsStratum::jobDelay(uint32_t pool) {
+	poolSession &session = *sessions[pool];
+	double delay = session.jobDelayMs;
+
+	if ((heightSeen.size() > 0) && (session.blockHeight < heightSeen.rbegin()->first)) {
+		auto behind = std::chrono::steady_clock::now() - heightSeen.rbegin()->second;
+		delay = max(delay, std::chrono::duration<double, std::milli>(behind).count());
+	}
+
+	return delay;
+}
+
+
+// Pick the pool to mine on. The active pool is left when it has no connection or work, when it
+// sends new blocks much later or answers much slower than another pool, or when a pool with higher
+// priority has been stable for the fail back time. Apart from a lost pool switches are rate limited.
+void hdsStratum::checkFailover() {
+	auto now = std::chrono::steady_clock::now();
+	poolSession &current = *sessions[active];
+	bool usable = current.loggedIn && current.lastJob;
+	bool mayMove = (now - lastSwitch) >= std::chrono::seconds(minSwitchSec);
+	double latency = (double) config.latencySwitchMs;
+
+	// Right after the login the first job is on the way
+	if (current.loggedIn && !current.lastJob && ((now - current.loginTime) < std::chrono::seconds(2))) return;
+
+	for (uint32_t i=0; i<sessions.size(); i++) {
+		poolSession &other = *sessions[i];
+		if ((i == active) || !other.loggedIn || !other.lastJob) continue;
+
+		if (!usable) {
+			switchPool(i, "no connection or work");
+			return;
+		}
+
+		if (!mayMove) continue;
+
+		bool notWorse = (jobDelay(i) <= jobDelay(active) + latency) && (other.rttMs <= current.rttMs + latency);
+
+		if ((i < active) && (config.failbackSec > 0) && notWorse && 
+		    ((now - other.loginTime) >= std::chrono::seconds(config.failbackSec))) {
+			switchPool(i, "fail back to a pool with higher priority");
+			return;
+		}
+
+		if (config.latencySwitchMs == 0) continue;
+
+		if (jobDelay(active) > jobDelay(i) + latency) {
+			switchPool(i, "new blocks arrive " + to_string((int) (jobDelay(active) - jobDelay(i))) + " ms later than there");
+			return;
 		}
 
-		// Prepare to continue reading
-		boost::asio::async_read_until(*socket, responseBuffer, "\n",
-        	boost::bind(&hdsStratum::readStratum, this, boost::asio::placeholders::error));
+		if (current.rttMs > other.rttMs + latency) {
+			switchPool(i, "round trip time " + to_string((int) current.rttMs) + " ms vs " + to_string((int) other.rttMs) + " ms");
+			return;
+		}
+	}
+}
+
+
+void hdsStratum::handlePolicyTimer(const boost::system::error_code& err) {
+	if (err) return;
+	checkFailover();
+
+	policyTimer.expires_after(std::chrono::seconds(5));
+	policyTimer.async_wait(boost::bind(&hdsStratum::handlePolicyTimer, this, boost::asio::placeholders::error));
+}
+
+
+// The standby is logged in and has a job already, so the GPUs continue without a pause
+void hdsStratum::switchPool(uint32_t pool, string reason) {
+	HDS_LOG(logInfo) << "Switching from pool " << poolName(active) << " to " << poolName(pool) << ": " << reason;
+
+	active = pool;
+	lastSwitch = std::chrono::steady_clock::now();
+
+	if (inGracePeriod) {
+		inGracePeriod = false;
+		graceTimer.cancel();
+	}
+
+	// A published snapshot is never changed, so the job goes out as a copy with a new epoch
+	std::shared_ptr<JobSnapshot> job = std::make_shared<JobSnapshot>(*sessions[pool]->lastJob);
+	sessions[pool]->lastJob = job;
+	publishJob(job);
+
+	HDS_LOG(logInfo) << "New job: " << job->workId << "  Difficulty: " << logPrecision(0) << job->powDiff.ToFloat();
+}
+
+
+// A switch asked for by the API, the failover policy may still switch back later
+void hdsStratum::handleSwitchRequest(uint32_t pool) {
+	if (pool == active) return;
+
+	if (!sessions[pool]->loggedIn || !sessions[pool]->lastJob) {
+		HDS_LOG(logInfo) << "Can not switch to " << poolName(pool) << ", it has no job";
+		return;
 	}
+	switchPool(pool, "requested by the API");
+}
+
+
+bool hdsStratum::requestSwitch(uint32_t pool) {
+	if (pool >= sessions.size()) return false;
+	io_service.post(boost::bind(&hdsStratum::handleSwitchRequest, this, pool));
+	return true;
+}
+
+
+// The pool state belongs to the stratum thread, so it is copied there. The share counters
+// are also available when the stratum thread does not answer in time.
+stratumStatus hdsStratum::getStatus() {
+	auto result = std::make_shared< std::promise<stratumStatus> >();
+
+	io_service.post([this, result]() {
+		stratumStatus status;
+		for (uint32_t i=0; i<sessions.size(); i++) {
+			poolStatus ps;
+			ps.name = poolName(i);
+			ps.loggedIn = sessions[i]->loggedIn;
+			ps.active = (i == active);
+			ps.rttMs = sessions[i]->rttMs;
+			ps.jobDelayMs = sessions[i]->jobDelayMs;
+			status.pools.push_back(ps);
+		}
+		status.partition = partition;
+		result->set_value(status);
+	});
+
+	stratumStatus status;
+	std::future<stratumStatus> answer = result->get_future();
+	if (answer.wait_for(std::chrono::seconds(1)) == std::future_status::ready) status = answer.get();
+
+	const JobSnapshot * job = currentJob.load(std::memory_order_acquire);
+	status.workId = job->workId;
+	status.difficulty = (job->workId >= 0) ? job->powDiff.ToFloat() : 0;
+	status.uptimeSec = (t_start > 0) ? (uint64_t) (time(NULL) - t_start) : 0;
+
+	boost::mutex::scoped_lock lock(historyMutex);
+	status.accepted = sharesAcc;
+	status.rejected = sharesRej;
+	status.stale = sharesStale;
+	return status;
+}
+
+
+string hdsStratum::poolName(uint32_t pool) {
+	return pools[pool].host + ":" + pools[pool].port;
 }
 
 
 // Checking if we have valid work, else the GPUs will pause
 bool hdsStratum::hasWork() {
-	return (workId >= 0);
+	return (currentJob.load(std::memory_order_acquire)->workId >= 0);
 }
 
 
-void hdsStratum::Blake2B_HdsIII(WorkDescription * wd) {
-	blake2bInstance blakeInst;
-	blakeInst.init(32,448,5, "Hds--PoW");
+// Epoch of the latest published job, work with a different epoch is outdated
+uint64_t hdsStratum::currentEpoch() {
+	return currentJob.load(std::memory_order_acquire)->epoch;
+}
+
+
+// Decide which PoW the current block height of a pool requires, only called from the stratum thread
+solverType hdsStratum::selectSolver(const poolSession &session) {
+	return solverAt(session, session.blockHeight);
+}
+
+
+// The PoW for a block height with the fork heights of a pool
+solverType hdsStratum::solverAt(const poolSession &session, uint64_t blockHeight) {
+	uint64_t limit = numeric_limits<uint64_t>::max();
+	uint64_t forkHeight = session.forkHeight;
+	uint64_t forkHeight2 = session.forkHeight2;
+
+	if (forcedSolver != None) {
+		return forcedSolver;
+	} else if ((blockHeight < limit) && (forkHeight < limit) && (blockHeight < forkHeight)) {
+		return HdsI;
+	} else if ((blockHeight < limit) && (forkHeight < limit) && (blockHeight >= forkHeight) && (blockHeight < forkHeight2)) {
+		return HdsII;
+	} 
+	return HdsIII;
+}
+
 
-	uint8_t msg[128] = {0};
+// The solver of the next fork when it is at most prestageBlocks ahead, None otherwise. Without a
+// known block height there is no fork to expect.
+solverType hdsStratum::upcomingSolver(const poolSession &session, solverType current) {
+	if ((forcedSolver != None) || (session.blockHeight == numeric_limits<uint64_t>::max())) return None;
+
+	for (uint64_t d=1; d<=config.prestageBlocks; d++) {
+		solverType next = solverAt(session, session.blockHeight + d);
+		if (next != current) return next;
+	}
+	return None;
+}
+
+
+// Makes a new job visible to the mining threads. Readers never lock: they load the
+// pointer and copy what they need. Replaced snapshots are kept alive for a grace
+// period that is far longer than any reader holds the pointer, then released.
+void hdsStratum::publishJob(std::shared_ptr<JobSnapshot> job) {
+	const JobSnapshot * replaced = currentJob.load();
+	job->epoch = ++jobEpoch;
+	job->published = std::chrono::steady_clock::now();
+
+	recordJob(job, false);
+
+	publishedJobs.push_back(job);
+	if (job->workId >= 0) reportPartition(job->poolNonceBytes);
+	currentJob.store(job.get(), std::memory_order_release);
+
+	// Launches of the replaced job finish while its solutions are still submitted, the kernels
+	// skip the rest once the stale window ended. Canceled jobs stop right away.
+	uint64_t oldest = job->epoch;
+	staleTimer.cancel();
+	if ((replaced != NULL) && inStaleWindow(replaced->epoch)) {
+		oldest = replaced->epoch;
+		staleTimer.expires_after(std::chrono::milliseconds(config.staleWindowMs));
+		staleTimer.async_wait(boost::bind(&hdsStratum::endStaleWindow, this, boost::asio::placeholders::error, job->epoch));
+	}
+
+	if (jobListener) jobListener(oldest);
+
+	while ((publishedJobs.size() > 2) && ((job->published - publishedJobs[1]->published) > std::chrono::seconds(10))) {
+		publishedJobs.pop_front();
+	}
+}
+
+
+// The listener is called from the stratum thread with the epoch of every newly published job
+void hdsStratum::setJobListener(std::function<void(uint64_t)> listener) {
+	jobListener = listener;
+}
+
+
+// Instance number from the configuration and the lease file. Without one the counters start at
+// random points, then other miners with the same key are only unlikely to overlap.
+void hdsStratum::setupPartition() {
+	config.instanceBits = min<uint32_t>(config.instanceBits, 24);
+	uint32_t slots = 1 << config.instanceBits;
+
+	instance = config.nonceInstance;
+	if (config.nonceLease.size() > 0) {
+		if (lease.acquire(config.nonceLease, slots)) {
+			instance = max(instance, 0) + lease.slot();
+		} else {
+			HDS_LOG(logWarning) << "Warning: no free slot in nonce lease file " << config.nonceLease << ", using a random nonce range";
+		}
+	}
+
+	if (instance >= (int32_t) slots) {
+		HDS_LOG(logWarning) << "Warning: nonce instance " << instance << " does not fit in " << config.instanceBits << " bits, using " << (instance % slots);
+		instance = instance % slots;
+	}
+
+	setDeviceCount(deviceCount);
+}
+
+
+// Every device gets its own counter and range, must be called before mining starts
+void hdsStratum::setDeviceCount(uint32_t count) {
+	deviceCount = max<uint32_t>(count, 1);
+	deviceBits = 0;
+	while ((((uint32_t) 1) << deviceBits) < deviceCount) deviceBits++;
+	if (config.deviceBits > deviceBits) {
+		deviceBits = min<uint32_t>(config.deviceBits, 16);
+	} else if ((config.deviceBits > 0) && (config.deviceBits < deviceBits)) {
+		HDS_LOG(logWarning) << "Warning: " << deviceCount << " devices do not fit in " << config.deviceBits << " nonce bits, using " << deviceBits;
+	}
+
+	random_device rd;
+	default_random_engine generator(rd());
+	uniform_int_distribution<uint64_t> distribution(0,0xFFFFFFFFFFFFFFFF);
+
+	// Counters start at a random point, so a restarted miner does not repeat the nonces of its last run
+	nonceCounters.reset(new nonceCounter[deviceCount]);
+	for (uint32_t i=0; i<deviceCount; i++) nonceCounters[i].value = distribution(generator);
+
+	partitionBytes = ~0u;
+}
+
+
+// Width of the counter left below the pool prefix, the instance and the device fields, 0 if that is
+// less than minCounterBits. A short counter would wrap within a job and repeat nonces.
+uint32_t hdsStratum::counterBits(uint32_t prefixBytes) {
+	uint32_t freeBits = 64 - 8*prefixBytes;
+	uint32_t fieldBits = ((instance >= 0) ? config.instanceBits : 0) + deviceBits;
+	return (fieldBits + minCounterBits <= freeBits) ? (freeBits - fieldBits) : 0;
+}
+
+
+// Shows the layout of the nonce whenever the pool prefix changes it
+void hdsStratum::reportPartition(uint32_t prefixBytes) {
+	if (prefixBytes == partitionBytes) return;
+	partitionBytes = prefixBytes;
+
+	partition = noncePartition();
+	partition.prefixBits = 8*prefixBytes;
+	partition.counterBits = counterBits(prefixBytes);
+	partition.partitioned = (partition.counterBits > 0);
+	if (!partition.partitioned) {
+		partition.counterBits = 64 - 8*prefixBytes;
+		HDS_LOG(logWarning) << "Warning: the nonce prefix of the pool leaves only " << (64 - 8*prefixBytes) << " bits, less than the instance and device fields and "
+				    << minCounterBits << " counter bits need. The nonce space is not partitioned";
+		return;
+	}
+
+	partition.instance = instance;
+	partition.instanceBits = (instance >= 0) ? config.instanceBits : 0;
+	partition.leaseSlot = lease.slot();
+	partition.deviceBits = deviceBits;
+
+	logLine line(logInfo);
+	line << "Nonce partition: pool prefix " << 8*prefixBytes << " bits, ";
+	if (instance >= 0) {
+		line << "instance " << instance << " of " << (1 << config.instanceBits);
+		if (lease.slot() >= 0) line << " (lease slot " << lease.slot() << ")";
+	} else {
+		line << "no instance (random start)";
+	}
+	line << ", " << deviceCount << " devices in " << deviceBits << " bits, " << partition.counterBits << " counter bits";
+}
+
+
+// Copy of the current job, snapshots stay alive long enough to copy them from any thread
+JobSnapshot hdsStratum::jobSnapshot() {
+	return *currentJob.load(std::memory_order_acquire);
+}
+
+
+// The listener is called from the stratum thread with the pool, work id and outcome of every share answer
+void hdsStratum::setShareListener(std::function<void(uint32_t, int64_t, bool)> listener) {
+	shareListener = listener;
+}
+
+
+// The listener is called from the stratum thread with the device index and the job difficulty of every share answer
+void hdsStratum::setDeviceShareListener(std::function<void(uint32_t, double, bool)> listener) {
+	deviceShareListener = listener;
+}
+
+
+// Keep track of the jobs we mined on. The newest entry is the job the GPUs currently work on,
+// older entries were replaced by a new job, canceled by the pool or lost with the connection.
+// The totals of a job are printed when it leaves the history, the pool has answered its shares by then.
+void hdsStratum::recordJob(std::shared_ptr<JobSnapshot> job, bool cancel) {
+	boost::mutex::scoped_lock lock(historyMutex);
+
+	if ((jobHistory.size() > 0) && !jobHistory.back().replaced) {
+		JobRecord &last = jobHistory.back();
+		last.replaced = true;
+		last.canceled = cancel;
+		last.replacedAt = std::chrono::steady_clock::now();
+	}
+
+	if (cancel || (job->workId < 0)) return;
+
+	JobRecord rec;
+	rec.job = job;
+	jobHistory.push_back(rec);
+
+	while (jobHistory.size() > jobHistorySize) {
+		const JobRecord &first = jobHistory.front();
+		HDS_LOG(logInfo) << "Job " << first.job->workId << " solutions (Submitted/Accepted/Rejected/Stale): " << first.submitted << " / " 
+		                 << first.accepted << " / " << first.rejected << " / " << first.stale;
+		jobHistory.pop_front();
+	}
+}
+
+
+// True for a replaced job whose solutions are submitted for a while, not for canceled ones
+bool hdsStratum::inStaleWindow(uint64_t epoch) {
+	boost::mutex::scoped_lock lock(historyMutex);
+
+	if (config.staleWindowMs == 0) return false;
+	for (auto &rec : jobHistory) {
+		if (rec.job->epoch == epoch) return rec.replaced && !rec.canceled;
+	}
+	return false;
+}
+
+
+// The stale window of the replaced job ended, kernels still running on it can stop
+void hdsStratum::endStaleWindow(const boost::system::error_code& err, uint64_t epoch) {
+	if (err) return;
+	if (jobListener) jobListener(epoch);
+}
+
+
+// Decide if a solution is still worth submitting: its job must be known, not canceled and
+// either current or replaced no longer than the stale window ago. Returns the pool of the job too.
+bool hdsStratum::acceptForSubmit(const WorkDescription& wd, uint32_t &pool) {
+	boost::mutex::scoped_lock lock(historyMutex);
+
+	for (auto rec = jobHistory.rbegin(); rec != jobHistory.rend(); ++rec) {
+		if (rec->job->epoch != wd.epoch) continue;
+
+		bool inWindow = !rec->replaced || (!rec->canceled && 
+				(std::chrono::steady_clock::now() - rec->replacedAt) <= std::chrono::milliseconds(config.staleWindowMs));
+
+		pool = rec->job->pool;
+		if (inWindow) {
+			rec->submitted++;
+			rec->devices.push_back(wd.device);
+		} else {
+			rec->stale++;
+			sharesStale++;
+		}
+		return inWindow;
+	}
+
+	sharesStale++;
+	return false;
+}
+
+
+// The pool answered a submitted solution, the answer carries the work id only
+void hdsStratum::recordShareResult(uint32_t pool, int64_t wId, bool accepted) {
+	bool found = false;
+	uint32_t device = 0;
+	double difficulty = 0;
+	{
+		boost::mutex::scoped_lock lock(historyMutex);
+
+		if (accepted) {
+			sharesAcc++;
+		} else {
+			sharesRej++;
+		}
+
+		for (auto rec = jobHistory.rbegin(); rec != jobHistory.rend(); ++rec) {
+			if ((rec->job->pool == pool) && (rec->job->workId == wId) && (rec->submitted > rec->accepted + rec->rejected)) {
+				if (accepted) {
+					rec->accepted++;
+				} else {
+					rec->rejected++;
+				}
+
+				if (!rec->devices.empty()) {
+					found = true;
+					device = rec->devices.front();
+					difficulty = rec->job->powDiff.ToFloat();
+					rec->devices.pop_front();
+				}
+				break;
+			}
+		}
+	}
+
+	// Outside the lock, the listener updates the statistics of the host
+	if (found && deviceShareListener) deviceShareListener(device, difficulty, accepted);
+}
+
+
+void hdsStratum::Blake2B_HdsIII(WorkDescription * wd) {
+	uint8_t msg[44];
 	memcpy(&msg[0], (uint8_t *) &wd->work, 32);
 	memcpy(&msg[32], (uint8_t *) &wd->nonce, 8);
 	memcpy(&msg[40], &extraNonce[0], 4);
 
-	blakeInst.update(&msg[0], 44, 1);	
-	blakeInst.ret_final((uint8_t*) &wd->work, 32);		
+	blake2bEquihashBatch(&msg[0], sizeof(msg), 1, 32, 448, 5, (uint8_t*) &wd->work);
 }
 
 
 // function the clHost class uses to fetch new work
 void hdsStratum::getWork(WorkDescription& wd, solverType * solver) {
 
-	// nonce is atomic, so every time we call this will get a nonce increased by one
-	uint64_t cliNonce = nonce.fetch_add(1);
+	// The snapshot is immutable, so no lock is needed to read from it
+	const JobSnapshot * job = currentJob.load(std::memory_order_acquire);
+
+	// The counter of the device is atomic, so every call gets a nonce range of the requested size
+	// the caller may then use nonce + i*nonceStep for i < iterations
+	uint32_t iterations = max<uint32_t>(wd.iterations, 1);
+	uint32_t device = min<uint32_t>(wd.device, deviceCount - 1);
+	uint64_t counter = nonceCounters[device].value.fetch_add(iterations, std::memory_order_relaxed);
+
+	uint64_t cliNonce = counter;
+	uint32_t cBits = counterBits(job->poolNonceBytes);
+	if (cBits > 0) {
+		// A range that would run over the end of the counter field is skipped, the next one starts at the
+		// wrapped counter. So the ranges only repeat after the whole field of at least 2^32 nonces was used.
+		uint64_t mask = (cBits < 64) ? ((((uint64_t) 1) << cBits) - 1) : ~((uint64_t) 0);
+		while ((counter & mask) > mask - iterations + 1) {
+			counter = nonceCounters[device].value.fetch_add(iterations, std::memory_order_relaxed);
+		}
+
+		cliNonce = (counter & mask) | (((uint64_t) device) << cBits);
+		if (instance >= 0) cliNonce |= ((uint64_t) instance) << (cBits + deviceBits);
+	}
 
 	uint8_t* noncePoint = (uint8_t*) &wd.nonce;
 
-	uint32_t poolNonceBytes = min<uint32_t>(poolNonce.size(), 6); 	// Need some range left for miner
-	wd.nonce = (cliNonce << 8*poolNonceBytes);
+	wd.nonce = (cliNonce << 8*job->poolNonceBytes);
+	wd.nonceStep = ((uint64_t) 1) << 8*job->poolNonceBytes;
+	memcpy(&wd.extraNonce, &extraNonce[0], 4);
 
-	for (uint32_t i=0; i<poolNonceBytes; i++) {			// Prefix pool nonce
-		noncePoint[i] = poolNonce[i];
+	for (uint32_t i=0; i<job->poolNonceBytes; i++) {			// Prefix pool nonce
+		noncePoint[i] = job->poolNonce[i];
 	}
 	
-	updateMutex.lock();
-
-	wd.workId = workId;
-	wd.powDiff = powDiff;
-
-	uint64_t limit = numeric_limits<uint64_t>::max();
-	//wd.forceHdsHashI = (blockHeight < limit) && (forkHeight < limit) && (blockHeight < forkHeight);
-	
-	solverType thisSolver;
-	if (forcedSolver != None) {
-		thisSolver = forcedSolver;
-	} else if ((blockHeight < limit) && (forkHeight < limit) && (blockHeight < forkHeight)) {
-		thisSolver = HdsI;
-	} else if ((blockHeight < limit) && (forkHeight < limit) && (blockHeight >= forkHeight) && (blockHeight < forkHeight2)) {
-		thisSolver = HdsII;
-	} else {
-		thisSolver = HdsIII;
-	}
+	wd.workId = job->workId;
+	wd.epoch = job->epoch;
+	wd.powDiff = job->powDiff;
+	wd.powTarget = job->powTarget;
+	wd.jobReceived = job->published;
 		
-	*solver = thisSolver;
-	wd.solver = thisSolver;
+	*solver = job->solver;
+	wd.solver = job->solver;
+	wd.nextSolver = job->nextSolver;
 	
-	memcpy(wd.work, serverWork.data(), 32);
+	memcpy(wd.work, job->work, 32);
 
-	if (*solver == HdsIII) {
+	if ((*solver == HdsIII) && !wd.devicePrePow) {
 		Blake2B_HdsIII(&wd);
 	}
-
-	updateMutex.unlock();
 }
 
 
@@ -469,17 +996,20 @@ std::vector<uint32_t> GetIndicesFromMinimal(std::vector<uint8_t> soln) {
 }
 
 
-bool hdsStratum::testSolution(const hds::Difficulty& diff, const vector<uint32_t>& indices, vector<uint8_t>& compressed) {
+// Checks the SHA256 of the compressed solution against the precomputed target of its job.
+// tools/targetBench compares it with the full product of IsTargetReached.
+bool hdsStratum::testHash(const WorkDescription& wd, const hds::uintBig_t<32>& hv) {
+	return wd.powTarget.IsReached(hv);
+}
 
-	// get the compressed representation of the solution and check against target
 
+bool hdsStratum::testSolution(const WorkDescription& wd, const vector<uint8_t>& compressed) {
 	hds::uintBig_t<32> hv;
 	Sha256_Onestep(compressed.data(), compressed.size(), hv.m_pData);
-
-	return diff.IsTargetReached(hv);
+	return testHash(wd, hv);
 }
 
-void hdsStratum::submitSolution(int64_t wId, uint64_t nonceIn, const std::vector<uint8_t>& compressed) {
+void hdsStratum::submitSolution(uint32_t pool, int64_t wId, uint64_t nonceIn, const std::vector<uint8_t>& compressed) {
 
 	// The solutions target is low enough, lets submit it
 	vector<uint8_t> nonceBytes;
@@ -502,55 +1032,109 @@ void hdsStratum::submitSolution(int64_t wId, uint64_t nonceIn, const std::vector
 	json << "{\"method\" : \"solution\", \"id\": \"" << wId << "\", \"nonce\": \"" << nonceHex.str() 
 			<< "\", \"output\": \"" << solutionHex.str() << "\", \"jsonrpc\":\"2.0\" } \n";
 
-	queueDataSend(json.str());	
+	queueDataSend(pool, json.str());	
 
-	cout << "Submitting solution to job " << wId << " with nonce " <<  nonceHex.str() << endl;
+	HDS_LOG(logInfo) << "Submitting solution to job " << wId << " with nonce " <<  nonceHex.str();
 }
 
 
-// Will be called by clHost class for check & submit
-void hdsStratum::handleSolution(const WorkDescription& wd, vector<uint32_t> &indices) {
+// Will be called by clHost class for check & submit, with all solutions of one iteration.
+// Their hashes are computed together, which uses the multi-buffer SHA256 on CPUs without SHA extensions.
+void hdsStratum::handleSolutions(const WorkDescription& wd, vector< vector<uint32_t> > &solutions) {
+	if (solutions.empty()) return;
 
-	std::vector<uint8_t> compressed;
+	vector< vector<uint8_t> > compressed(solutions.size());
+	{
+		traceScope span("pack", "solution");
+		for (uint32_t i=0; i<solutions.size(); i++) {
+			if (wd.solver == HdsIII) {
+				compressed[i] = packHdsIII(solutions[i]);
+			} else {
+				compressed[i] = GetMinimalFromIndices(solutions[i],25);
+			}
+		}
+	}
 
-	if (wd.solver == HdsIII) {
-		compressed = packHdsIII(indices);
-	} else {
-		compressed = GetMinimalFromIndices(indices,25);
+	// The target is the one of the job the solution was mined on
+	static_assert(sizeof(hds::uintBig_t<32>) == SHA256_DIGEST_SIZE, "hashes are written back to back");
+	vector< hds::uintBig_t<32> > hashes(solutions.size());
+	vector<bool> submit(solutions.size());
+	uint32_t pool = 0;
+	{
+		traceScope span("verify", "solution");
+		size_t size = compressed[0].size();
+		vector<uint8_t> packed(size * compressed.size());
+		for (uint32_t i=0; i<compressed.size(); i++) {
+			if (compressed[i].size() == size) memcpy(&packed[i * size], compressed[i].data(), size);
+		}
+		Sha256_Many(packed.data(), size, size, compressed.size(), hashes[0].m_pData);
+
+		for (uint32_t i=0; i<compressed.size(); i++) {
+			bool reached = (compressed[i].size() == size) ? testHash(wd, hashes[i]) : testSolution(wd, compressed[i]);
+			submit[i] = reached && acceptForSubmit(wd, pool);
+		}
+		if (span.enabled()) span.args = "\"workId\":" + to_string(wd.workId) + ",\"solutions\":" + to_string(solutions.size());
+	}
+
+	for (uint32_t i=0; i<compressed.size(); i++) {
+		if (!submit[i]) continue;
+		if (traceEnabled()) traceInstant("share sent", "stratum", "\"workId\":" + to_string(wd.workId) + ",\"pool\":" + to_string(pool));
+		std::thread (&hdsStratum::submitSolution,this,pool,wd.workId,wd.nonce,std::move(compressed[i])).detach();
 	}
+}
+
+
+// Solution of a downstream miner of the proxy, already compressed. The work description needs
+// the epoch, work id, nonce and target of the job. Returns 1 if submitted, 0 if stale, -1 if the target is missed.
+int32_t hdsStratum::forwardSolution(const WorkDescription& wd, const std::vector<uint8_t>& compressed, uint32_t &pool) {
+	if (!testSolution(wd, compressed)) return -1;
+	if (!acceptForSubmit(wd, pool)) return 0;
 
-	if (testSolution(wd.powDiff, indices, compressed))
-		std::thread (&hdsStratum::submitSolution,this,wd.workId,wd.nonce,std::move(compressed)).detach();
+	if (traceEnabled()) traceInstant("share sent", "stratum", "\"workId\":" + to_string(wd.workId) + ",\"pool\":" + to_string(pool));
+
+	submitSolution(pool, wd.workId, wd.nonce, compressed);
+	return 1;
 }
 
 
-hdsStratum::hdsStratum(string hostIn, string portIn, string apiKeyIn, bool debugIn, solverType forcedIn) : res(io_service), context(boost::asio::ssl::context::tlsv12)  {
+hdsStratum::hdsStratum(std::vector<poolAddress> poolsIn, string apiKeyIn, bool debugIn, solverType forcedIn, stratumConfig configIn) : context(boost::asio::ssl::context::sslv23_client), policyTimer(io_service), staleTimer(io_service), graceTimer(io_service)  {
 
 	context.set_options(	  boost::asio::ssl::context::default_workarounds
 				| boost::asio::ssl::context::no_sslv2
                 		| boost::asio::ssl::context::no_sslv3
 				| boost::asio::ssl::context::no_tlsv1
+				| boost::asio::ssl::context::no_tlsv1_1
 				| boost::asio::ssl::context::single_dh_use);
 
-	host = hostIn;
-	port = portIn;
+	pools = poolsIn;
 	apiKey = apiKeyIn;
 	debug = debugIn;
 
 	forcedSolver = forcedIn;
+	config = configIn;
 
-	// Assign the work field and nonce
-	serverWork.assign(32,(uint8_t) 0);
+	if (config.captureFile.size() > 0) {
+		if (capture.open(config.captureFile)) {
+			HDS_LOG(logInfo) << "Capturing the stratum traffic to " << config.captureFile;
+		} else {
+			HDS_LOG(logWarning) << "Warning: can not open capture file " << config.captureFile;
+		}
+	}
+
+	// Every pool in the list gets its own connection, the first one starts as active pool
+	for (uint32_t i=0; i<pools.size(); i++) {
+		sessions.emplace_back(new poolSession());
+		sessions[i]->connection.reset(new poolConnection(io_service, context, pools[i].host, pools[i].port, debug, config.useTLS));
+		sessions[i]->connection->setHandlers(boost::bind(&hdsStratum::handleConnected, this, i), 
+						     boost::bind(&hdsStratum::readStratum, this, i, _1), 
+						     boost::bind(&hdsStratum::handleDisconnected, this, i));
+	}
 
-	random_device rd;
-	default_random_engine generator(rd());
-	uniform_int_distribution<uint64_t> distribution(0,0xFFFFFFFFFFFFFFFF);
 
-	// We pick a random start nonce
-	nonce = distribution(generator);
+	setupPartition();
 
 	// No work in the beginning
-	workId = -1;
+	publishJob(std::make_shared<JobSnapshot>());
 }
 
 } // End namespace hdsMiner
@@ -13,6 +13,12 @@
 #include <limits>
 #include <deque>
 #include <random>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <future>
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/asio.hpp>
@@ -27,6 +33,11 @@
 #include "core/uintBig.h"
 
 #include "hdsUtil.h"
+#include "hdsLog.h"
+#include "hdsTrace.h"
+#include "poolConnection.h"
+#include "stratumCapture.h"
+#include "nonceLease.h"
 
 #ifndef hdsStratum_H
 #define hdsStratum_H
@@ -38,75 +49,236 @@ namespace pt = boost::property_tree;
 
 namespace hdsMiner {
 
+// Immutable description of one stratum job. The stratum thread publishes a new
+// instance for every job change, the mining threads only read from it.
+struct JobSnapshot {
+	int64_t workId = -1;
+	uint64_t epoch = 0;
+	uint64_t work[4] = {0};
+	hds::Difficulty powDiff;
+	hds::Difficulty::Target powTarget;	// powDiff as target, computed once per job
+	solverType solver = None;
+	solverType nextSolver = None;	// Takes over at a fork height close ahead, None if there is none
+	uint8_t poolNonce[8] = {0};
+	uint32_t poolNonceBytes = 0;
+	uint32_t pool = 0;
+	uint64_t height = 0;
+	std::chrono::steady_clock::time_point published;
+};
+
+// Recent job together with the fate of the solutions found for it
+struct JobRecord {
+	std::shared_ptr<JobSnapshot> job;
+	bool replaced = false;
+	bool canceled = false;
+	std::chrono::steady_clock::time_point replacedAt;
+	uint64_t submitted = 0;
+	uint64_t accepted = 0;
+	uint64_t rejected = 0;
+	uint64_t stale = 0;
+	std::deque<uint32_t> devices;	// Devices of the submitted solutions still waiting for an answer, in order
+};
+
+// Options for the stratum client set from the command line
+struct stratumConfig {
+	uint32_t staleWindowMs = 3000;	// Solutions for a replaced job found within this time are still submitted
+	uint32_t reconnectGraceSec = 30;// Keep mining the last job this long while the connection is down
+	uint32_t failbackSec = 120;	// A pool with higher priority must be up this long before it gets active again
+	uint32_t latencySwitchMs = 1000;// Switch pools when the active one sends jobs this much later than another (0 = off)
+	bool useTLS = true;		// Plain TCP is meant for nodes on localhost or in the LAN
+	string captureFile;		// Record all stratum lines to this file, empty = off
+	uint16_t proxyPort = 0;		// Serve the jobs to downstream miners on this port instead of mining, 0 = off
+	int32_t nonceInstance = -1;	// Number of this miner in the nonce space, added to the lease slot (-1 = random start)
+	uint32_t instanceBits = 8;	// Nonce bits for the instance number
+	uint32_t deviceBits = 0;	// Nonce bits for the device index, sets the stride between device ranges (0 = as the devices need)
+	string nonceLease;		// Lease file that gives every miner process on the host its own slot
+	uint32_t prestageBlocks = 5;	// Prepare the solver of a fork this many blocks ahead (0 = off)
+};
+
+// Address of a stratum server, the miner uses them in the order given
+struct poolAddress {
+	string host;
+	string port;
+};
+
+// One stratum server of the pool list with its own connection. All pools stay connected and
+// logged in, but only the jobs of the active one are published to the GPUs.
+struct poolSession {
+	std::unique_ptr<poolConnection> connection;
+	bool loggedIn = false;
+	std::chrono::steady_clock::time_point loginTime;
+	std::vector<uint8_t> poolNonce;
+	uint64_t blockHeight = ~((uint64_t) 0);
+	uint64_t forkHeight  = ~((uint64_t) 0);
+	uint64_t forkHeight2 = ~((uint64_t) 0);
+	std::shared_ptr<JobSnapshot> lastJob;	// Newest job of this pool, null if there is none
+	std::deque<std::chrono::steady_clock::time_point> requestSent;
+	double rttMs = 0;			// Smoothed time from a request until its answer
+	double jobDelayMs = 0;			// Smoothed time a new block reaches us later than from the fastest pool
+};
+
+// State of the stratum client for the API, a copy taken on the stratum thread
+struct poolStatus {
+	string name;
+	bool loggedIn = false;
+	bool active = false;
+	double rttMs = 0;
+	double jobDelayMs = 0;
+};
+
+// Layout of the nonce below the pool prefix: instance, device and counter field from the top
+struct noncePartition {
+	bool partitioned = false;	// False: one random counter per device over the whole free space
+	uint32_t prefixBits = 0;
+	int32_t instance = -1;
+	uint32_t instanceBits = 0;
+	int32_t leaseSlot = -1;
+	uint32_t deviceBits = 0;
+	uint32_t counterBits = 0;
+};
+
+struct stratumStatus {
+	std::vector<poolStatus> pools;
+	noncePartition partition;
+	uint64_t accepted = 0;
+	uint64_t rejected = 0;
+	uint64_t stale = 0;
+	int64_t workId = -1;
+	double difficulty = 0;
+	uint64_t uptimeSec = 0;
+};
 
 class hdsStratum {
 	private:
 
 	// Definitions belonging to the physical connection
 	boost::asio::io_service io_service;
-	boost::scoped_ptr< boost::asio::ssl::stream<tcp::socket> > socket;
-	tcp::resolver res;
-	boost::asio::streambuf requestBuffer;
-	boost::asio::streambuf responseBuffer;
 	boost::asio::ssl::context context;
 
 	// User Data
-	string host;
-	string port;
+	std::vector<poolAddress> pools;
 	string apiKey;
 	bool debug = true;
 
+	// Pool sessions and failover policy, only used from the stratum thread
+	std::vector< std::unique_ptr<poolSession> > sessions;
+	uint32_t active = 0;
+	std::chrono::steady_clock::time_point lastSwitch;
+	std::map<uint64_t, std::chrono::steady_clock::time_point> heightSeen;
+	boost::asio::steady_timer policyTimer;
+	static constexpr uint32_t minSwitchSec = 30;
+	void checkFailover();
+	void handlePolicyTimer(const boost::system::error_code&);
+	void switchPool(uint32_t, string);
+	void handleSwitchRequest(uint32_t);
+	void trackJobDelay(uint32_t, uint64_t);
+	double jobDelay(uint32_t);
+	string poolName(uint32_t);
+
 	// Storage for received work
-	int64_t workId;
-	std::vector<uint8_t> serverWork;
-	std::atomic<uint64_t> nonce;
-	hds::Difficulty powDiff;
-	std::vector<uint8_t> poolNonce;
+	std::atomic<const JobSnapshot*> currentJob;
+	std::deque< std::shared_ptr<JobSnapshot> > publishedJobs;
+	uint64_t jobEpoch = 0;
+
+	// Nonce partitioning: below the pool prefix the nonce holds the instance number, the device
+	// index and a counter per device. Every counter sits on its own cache line.
+	struct alignas(64) nonceCounter {
+		std::atomic<uint64_t> value;
+	};
+	std::unique_ptr<nonceCounter[]> nonceCounters;
+	uint32_t deviceCount = 1;
+	uint32_t deviceBits = 0;
+	int32_t instance = -1;
+	uint32_t partitionBytes = ~0u;		// Pool prefix length the partition was last reported for
+	noncePartition partition;		// Layout reported last, only used from the stratum thread
+	static constexpr uint32_t minCounterBits = 32;
+	uint32_t counterBits(uint32_t);
+	nonceLease lease;
+	void setupPartition();
+	void reportPartition(uint32_t);
 	uint8_t extraNonce[4] = {0};
+	void publishJob(std::shared_ptr<JobSnapshot>);
+	solverType selectSolver(const poolSession&);
+	solverType solverAt(const poolSession&, uint64_t);
+	solverType upcomingSolver(const poolSession&, solverType);
+	std::function<void(uint64_t)> jobListener;	// Gets the oldest epoch whose solutions are still submitted
+	std::function<void(uint32_t, int64_t, bool)> shareListener;
+	std::function<void(uint32_t, double, bool)> deviceShareListener;
+
+	// Recently mined jobs, used to judge solutions that arrive late
+	stratumConfig config;
+	std::deque<JobRecord> jobHistory;
+	boost::mutex historyMutex;
+	static const uint32_t jobHistorySize = 8;
+	void recordJob(std::shared_ptr<JobSnapshot>, bool);
+	void recordShareResult(uint32_t, int64_t, bool);
+	bool acceptForSubmit(const WorkDescription&, uint32_t&);
+
+	// Kernels of a replaced job run on until its stale window ended
+	boost::asio::steady_timer staleTimer;
+	bool inStaleWindow(uint64_t);
+	void endStaleWindow(const boost::system::error_code&, uint64_t);
 
 	// Stat
 	uint64_t sharesAcc = 0;
 	uint64_t sharesRej = 0;
-	time_t t_start, t_current;
+	uint64_t sharesStale = 0;
+	time_t t_start = 0, t_current = 0;
 
 	//Stratum sending subsystem
-	bool activeWrite = false;
-	void queueDataSend(string);
-	void syncSend(string);
-	void activateWrite();
-	void writeHandler(const boost::system::error_code&);	
-	std::deque<string> writeRequests;
+	void queueDataSend(uint32_t, string);
+	void sendShare(uint32_t, string);
 
 	// Stratum receiving subsystem
-	void readStratum(const boost::system::error_code&);
-	boost::mutex updateMutex;
+	void readStratum(uint32_t, const string&);
 
-	// Connection handling
+	// Optional capture of all stratum lines for a later replay with the mock pool
+	stratumCaptureWriter capture;
+
+	// Connection handling, shares for a pool that is not connected wait in pendingShares
+	bool inGracePeriod = false;
+	std::chrono::steady_clock::time_point disconnectedAt;
+	boost::asio::steady_timer graceTimer;
+	std::deque< std::pair<uint32_t, string> > pendingShares;
+	static const uint32_t maxPendingShares = 256;
+	void startGracePeriod();
+	void endGracePeriod(const boost::system::error_code&);
+	void flushPendingShares(uint32_t);
 	void connect();
-	void handleConnect(const boost::system::error_code& err,  tcp::resolver::iterator);
-	void handleHandshake(const boost::system::error_code& err);
-	bool verifyCertificate(bool,boost::asio::ssl::verify_context& );
+	void handleConnected(uint32_t);
+	void handleDisconnected(uint32_t);
 
 	// Solution Check & Submit
 	std::vector<uint8_t> packHdsIII(std::vector<uint32_t> &);
 	void Blake2B_HdsIII(WorkDescription *);
-	static bool testSolution(const hds::Difficulty&, const std::vector<uint32_t>&, std::vector<uint8_t>&);
-	void submitSolution(int64_t, uint64_t, const std::vector<uint8_t>&);
+	static bool testSolution(const WorkDescription&, const std::vector<uint8_t>&);
+	static bool testHash(const WorkDescription&, const hds::uintBig_t<32>&);
+	void submitSolution(uint32_t, int64_t, uint64_t, const std::vector<uint8_t>&);
 
 	// Fork Information
 	solverType forcedSolver = None;
-	uint64_t blockHeight = ~((uint64_t) 0);
-	uint64_t forkHeight  = ~((uint64_t) 0);
-	uint64_t forkHeight2 = ~((uint64_t) 0);
 
 	public:
-	hdsStratum(string, string, string, bool, solverType);
+	hdsStratum(std::vector<poolAddress>, string, bool, solverType, stratumConfig = stratumConfig());
 	void startWorking();
 
 	bool hasWork();
+	uint64_t currentEpoch();
 	void getWork(WorkDescription&, solverType*);
+	void setJobListener(std::function<void(uint64_t)>);
+	void setDeviceCount(uint32_t);
+	JobSnapshot jobSnapshot();
+
+	void handleSolutions(const WorkDescription&, std::vector< std::vector<uint32_t> >&);
+	void setDeviceShareListener(std::function<void(uint32_t, double, bool)>);
+
+	// Used by the proxy for solutions of downstream miners
+	int32_t forwardSolution(const WorkDescription&, const std::vector<uint8_t>&, uint32_t&);
+	void setShareListener(std::function<void(uint32_t, int64_t, bool)>);
 
-	void handleSolution(const WorkDescription&, std::vector<uint32_t>&);
+	// Used by the API, safe to call from any thread
+	stratumStatus getStatus();
+	bool requestSwitch(uint32_t);
 	
 };
 
@@ -0,0 +1,73 @@
+// HDS OpenCL Miner
+// Lease of a nonce partition shared by the miners on one host
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "nonceLease.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace hdsMiner {
+
+// Takes the lowest free slot below the given count, false if all are taken
+bool nonceLease::acquire(const string& fileName, uint32_t slots) {
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return false;
+
+	for (uint32_t i=0; i<slots; i++) {
+		OVERLAPPED region = {0};
+		region.Offset = i;
+		if (LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &region)) {
+			handle = file;
+			leased = i;
+			return true;
+		}
+	}
+
+	CloseHandle(file);
+	return false;
+#else
+	int file = open(fileName.c_str(), O_RDWR | O_CREAT, 0666);
+	if (file < 0) return false;
+
+	for (uint32_t i=0; i<slots; i++) {
+		struct flock region = {};
+		region.l_type = F_WRLCK;
+		region.l_whence = SEEK_SET;
+		region.l_start = i;
+		region.l_len = 1;
+
+		// Open file description locks also separate several leases of one process
+#ifdef F_OFD_SETLK
+		int res = fcntl(file, F_OFD_SETLK, &region);
+#else
+		int res = fcntl(file, F_SETLK, &region);
+#endif
+		if (res == 0) {
+			fd = file;
+			leased = i;
+			return true;
+		}
+	}
+
+	close(file);
+	return false;
+#endif
+}
+
+
+nonceLease::~nonceLease() {
+#ifdef _WIN32
+	if (handle != NULL) CloseHandle((HANDLE) handle);
+#else
+	if (fd >= 0) close(fd);
+#endif
+}
+
+}
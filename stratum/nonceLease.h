@@ -0,0 +1,35 @@
+// HDS OpenCL Miner
+// Lease of a nonce partition shared by the miners on one host
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <string>
+#include <cstdint>
+
+#ifndef nonceLease_H
+#define nonceLease_H
+
+using namespace std;
+
+namespace hdsMiner {
+
+// Every miner process locks one byte of the lease file, the offset of the byte is its slot.
+// The lock lives as long as the process, so a crashed miner frees its slot automatically.
+class nonceLease {
+	private:
+#ifdef _WIN32
+	void* handle = NULL;
+#else
+	int fd = -1;
+#endif
+	int32_t leased = -1;
+
+	public:
+	bool acquire(const string&, uint32_t);
+	int32_t slot() { return leased; }
+	~nonceLease();
+};
+
+}
+
+#endif
@@ -0,0 +1,479 @@
+// HDS OpenCL Miner
+// Asynchronous connection to a stratum server
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "poolConnection.h"
+
+namespace hdsMiner {
+
+std::map<string, poolConnection::dnsEntry> poolConnection::dnsCache;
+boost::mutex poolConnection::dnsMutex;
+
+
+// Helper to print durations in milliseconds
+inline double msSince(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+
+// Private network ranges (RFC 1918, IPv6 unique local and link local)
+inline bool isPrivate(const boost::asio::ip::address &addr) {
+	if (addr.is_v4()) {
+		uint32_t ip = addr.to_v4().to_uint();
+		return ((ip >> 24) == 10) || ((ip >> 20) == 0xAC1) || ((ip >> 16) == 0xC0A8);
+	}
+
+	boost::asio::ip::address_v6 v6 = addr.to_v6();
+	return v6.is_link_local() || ((v6.to_bytes()[0] & 0xFE) == 0xFC);
+}
+
+
+// Endpoints of a previous lookup. Expired entries are only returned when asked for,
+// they are better than nothing if the DNS server does not answer.
+bool poolConnection::cachedEndpoints(std::vector<tcp::endpoint> &endpoints, bool allowExpired) {
+	boost::mutex::scoped_lock lock(dnsMutex);
+
+	auto entry = dnsCache.find(name());
+	if (entry == dnsCache.end()) return false;
+
+	bool fresh = (std::chrono::steady_clock::now() - entry->second.resolved) < std::chrono::seconds(dnsCacheSec);
+	if (!fresh && !allowExpired) return false;
+
+	endpoints = entry->second.endpoints;
+	return (endpoints.size() > 0);
+}
+
+
+void poolConnection::storeEndpoints(const std::vector<tcp::endpoint> &endpoints) {
+	boost::mutex::scoped_lock lock(dnsMutex);
+
+	dnsEntry entry;
+	entry.endpoints = endpoints;
+	entry.resolved = std::chrono::steady_clock::now();
+	dnsCache[name()] = entry;
+}
+
+
+// None of the endpoints answered, maybe the server moved. Resolve again next time.
+void poolConnection::dropEndpoints() {
+	boost::mutex::scoped_lock lock(dnsMutex);
+	dnsCache.erase(name());
+}
+
+
+// Begin a new connection, an existing one is closed
+void poolConnection::start() {
+	uint64_t gen = ++generation;
+	resetSocket();
+	retryTimer.cancel();
+
+	times = connectionTimes();
+	tStart = std::chrono::steady_clock::now();
+
+	deadlineTimer.expires_after(std::chrono::seconds(connectTimeoutSec));
+	deadlineTimer.async_wait(boost::bind(&poolConnection::handleDeadline, this, boost::asio::placeholders::error, gen));
+
+	HDS_LOG(logInfo) << "Connecting to " << host << ":" << port;
+
+	std::vector<tcp::endpoint> endpoints;
+	if (cachedEndpoints(endpoints, false)) {
+		times.dnsCached = true;
+		tResolved = tStart;
+		dial(endpoints);
+		return;
+	}
+
+	tcp::resolver::query q(host, port);
+	res.async_resolve(q, boost::bind(&poolConnection::handleResolve, this, boost::asio::placeholders::error, boost::asio::placeholders::iterator, gen));
+}
+
+
+void poolConnection::handleResolve(const boost::system::error_code& err, tcp::resolver::iterator it, uint64_t gen) {
+	if (gen != generation) return;
+	tResolved = std::chrono::steady_clock::now();
+
+	std::vector<tcp::endpoint> endpoints;
+	if (!err) {
+		for (; it != tcp::resolver::iterator(); ++it) endpoints.push_back(it->endpoint());
+		if (endpoints.size() > 0) storeEndpoints(endpoints);
+	} else if (cachedEndpoints(endpoints, true)) {
+		HDS_LOG(logInfo) << "Resolving " << host << " failed (" << err.message() << "), using the last known addresses";
+		times.dnsCached = true;
+	}
+
+	if (endpoints.size() == 0) {
+		fail("could not resolve " + host + (err ? ": " + err.message() : ""));
+		return;
+	}
+
+	dial(endpoints);
+}
+
+
+// Order the endpoints alternating between the address families, so a broken IPv6 or IPv4
+// route costs one stagger interval only (RFC 8305 style)
+void poolConnection::dial(std::vector<tcp::endpoint> endpoints) {
+	std::vector<tcp::endpoint> first, second;
+	bool firstV6 = endpoints[0].address().is_v6();
+	for (auto &ep : endpoints) {
+		if (ep.address().is_v6() == firstV6) {
+			first.push_back(ep);
+		} else {
+			second.push_back(ep);
+		}
+	}
+
+	dialList.clear();
+	for (uint32_t i=0; i<max(first.size(), second.size()); i++) {
+		if (i < first.size()) dialList.push_back(first[i]);
+		if (i < second.size()) dialList.push_back(second[i]);
+	}
+
+	attempts.clear();
+	nextAttempt = 0;
+	failedAttempts = 0;
+	startAttempt(generation);
+}
+
+
+// Dial the next endpoint, if the list is not done yet the one after follows after the stagger time
+void poolConnection::startAttempt(uint64_t gen) {
+	uint32_t idx = nextAttempt++;
+
+	connPtr conn = std::make_shared<connectionData>(io_service, context);
+	conn->stream.set_verify_mode(boost::asio::ssl::verify_none);
+	attempts.push_back(conn);
+
+	if (useTLS) {
+		// Server name indication is for host names only
+		boost::system::error_code ec;
+		boost::asio::ip::make_address(host, ec);
+		if (ec) SSL_set_tlsext_host_name(conn->stream.native_handle(), host.c_str());
+
+		offerSession(conn->stream.native_handle());
+	}
+
+	HDS_LOG(logDebug) << "Dialing " << dialList[idx];
+	conn->stream.lowest_layer().async_connect(dialList[idx],
+		boost::bind(&poolConnection::handleDial, this, boost::asio::placeholders::error, idx, gen, conn));
+
+	if (nextAttempt < dialList.size()) {
+		dialTimer.expires_after(std::chrono::milliseconds(dialStaggerMs));
+		dialTimer.async_wait(boost::bind(&poolConnection::handleDialTimer, this, boost::asio::placeholders::error, gen));
+	}
+}
+
+
+void poolConnection::handleDialTimer(const boost::system::error_code& err, uint64_t gen) {
+	if (err || (gen != generation) || socket) return;
+	if (nextAttempt < dialList.size()) startAttempt(gen);
+}
+
+
+// The first attempt that connects wins, all others are closed
+void poolConnection::handleDial(const boost::system::error_code& err, uint32_t idx, uint64_t gen, connPtr conn) {
+	if ((gen != generation) || socket) return;
+
+	if (err) {
+		if (err == boost::asio::error::operation_aborted) return;
+		failedAttempts++;
+		HDS_LOG(logDebug) << "Connecting to " << dialList[idx] << " failed: " << err.message();
+
+		// Do not wait for the stagger when an attempt failed already
+		if (nextAttempt < dialList.size()) {
+			startAttempt(gen);
+		} else if (failedAttempts == dialList.size()) {
+			dropEndpoints();
+			fail("no address of " + host + " reachable (" + err.message() + ")");
+		}
+		return;
+	}
+
+	tConnected = std::chrono::steady_clock::now();
+	remote = dialList[idx];
+	dialTimer.cancel();
+
+	boost::system::error_code ec;
+	for (uint32_t i=0; i<attempts.size(); i++) {
+		if (i != idx) attempts[i]->stream.lowest_layer().close(ec);
+	}
+	attempts.clear();
+
+	socket = conn;
+	socket->stream.lowest_layer().set_option(tcp::no_delay(true), ec);
+	HDS_LOG(logInfo) << "Node connection: ok (" << remote << ")";
+
+	if (!useTLS) {
+		handleHandshake(boost::system::error_code(), gen, socket);
+		return;
+	}
+
+	socket->stream.async_handshake(boost::asio::ssl::stream_base::client,
+		boost::bind(&poolConnection::handleHandshake, this, boost::asio::placeholders::error, gen, socket));
+}
+
+
+void poolConnection::handleHandshake(const boost::system::error_code& err, uint64_t gen, connPtr conn) {
+	(void) conn;	// Only holds the socket alive until the handshake completes
+	if (gen != generation) return;
+
+	if (err) {
+		tlsSession.clear();
+		fail("TLS handshake failed: " + err.message());
+		return;
+	}
+
+	tHandshake = std::chrono::steady_clock::now();
+	established = true;
+
+	if (useTLS) {
+		times.tlsResumed = (SSL_session_reused(socket->stream.native_handle()) == 1);
+		HDS_LOG(logInfo) << "TLS Handshake:   ok" << (times.tlsResumed ? " (resumed)" : "");
+
+		boost::asio::async_read_until(socket->stream, socket->responseBuffer, "\n",
+			boost::bind(&poolConnection::handleRead, this, boost::asio::placeholders::error, gen, socket));
+	} else {
+		boost::asio::async_read_until(socket->stream.next_layer(), socket->responseBuffer, "\n",
+			boost::bind(&poolConnection::handleRead, this, boost::asio::placeholders::error, gen, socket));
+	}
+
+	if (connectedHandler) connectedHandler();
+}
+
+
+void poolConnection::handleRead(const boost::system::error_code& err, uint64_t gen, connPtr conn) {
+	if (gen != generation) return;
+
+	if (err) {
+		fail(err.message());
+		return;
+	}
+
+	std::istream is(&conn->responseBuffer);
+	std::string line;
+	getline(is, line);
+
+	if (lineHandler) lineHandler(line);
+
+	// The handler may have closed the connection
+	if (gen != generation) return;
+
+	if (useTLS) {
+		boost::asio::async_read_until(conn->stream, conn->responseBuffer, "\n",
+			boost::bind(&poolConnection::handleRead, this, boost::asio::placeholders::error, gen, conn));
+	} else {
+		boost::asio::async_read_until(conn->stream.next_layer(), conn->responseBuffer, "\n",
+			boost::bind(&poolConnection::handleRead, this, boost::asio::placeholders::error, gen, conn));
+	}
+}
+
+
+// Queue a message, it is dropped when there is no connection
+void poolConnection::send(string data) {
+	if (!established) {
+		HDS_LOG(logDebug) << "Not connected, dropping: " << data;
+		return;
+	}
+
+	writeRequests.push_back(data);
+	activateWrite();
+}
+
+
+void poolConnection::activateWrite() {
+	if (!activeWrite && writeRequests.size() > 0) {
+		activeWrite = true;
+
+		string json = writeRequests.front();
+		writeRequests.pop_front();
+
+		std::ostream os(&socket->requestBuffer);
+		os << json;
+		HDS_LOG(logDebug) << "Write to connection: " << json;
+
+		if (useTLS) {
+			boost::asio::async_write(socket->stream, socket->requestBuffer,
+				boost::bind(&poolConnection::handleWrite, this, boost::asio::placeholders::error, generation, socket));
+		} else {
+			boost::asio::async_write(socket->stream.next_layer(), socket->requestBuffer,
+				boost::bind(&poolConnection::handleWrite, this, boost::asio::placeholders::error, generation, socket));
+		}
+	}
+}
+
+
+void poolConnection::handleWrite(const boost::system::error_code& err, uint64_t gen, connPtr conn) {
+	(void) conn;	// Only holds the socket alive until the write completes
+	if (gen != generation) return;
+	activeWrite = false;
+
+	if (err) {
+		fail("write to stratum failed: " + err.message());
+		return;
+	}
+
+	activateWrite();
+}
+
+
+void poolConnection::handleDeadline(const boost::system::error_code& err, uint64_t gen) {
+	if (err || (gen != generation)) return;
+	fail("no login within " + to_string(connectTimeoutSec) + " seconds");
+}
+
+
+// Close the socket and all attempts, their handlers still run once with an error
+void poolConnection::resetSocket() {
+	boost::system::error_code ec;
+	res.cancel();
+	dialTimer.cancel();
+
+	for (auto &conn : attempts) conn->stream.lowest_layer().close(ec);
+	attempts.clear();
+
+	if (socket) socket->stream.lowest_layer().close(ec);
+	socket.reset();
+
+	established = false;
+	activeWrite = false;
+	writeRequests.clear();
+}
+
+
+// Drop the connection on purpose, a new one is made after the backoff time
+void poolConnection::close(string reason) {
+	fail(reason);
+}
+
+
+// Something went wrong: close everything and retry after a jittered exponential backoff
+void poolConnection::fail(string reason) {
+	bool wasEstablished = established;
+
+	generation++;
+	resetSocket();
+	deadlineTimer.cancel();
+
+	if (wasEstablished) {
+		HDS_LOG(logInfo) << "Lost connection to " << name() << ": " << reason;
+		if (disconnectedHandler) disconnectedHandler();
+	} else {
+		HDS_LOG(logInfo) << "Connection to " << name() << " failed: " << reason;
+	}
+
+	// Half of the delay is fixed, the other half random, so many miners do not reconnect in lockstep
+	uint64_t delayMs = min<uint64_t>(((uint64_t) backoffBaseMs) << min<uint32_t>(failures, 16), backoffMaxMs);
+	std::uniform_int_distribution<uint64_t> jitter(0, delayMs / 2);
+	delayMs = delayMs / 2 + jitter(rng);
+	failures++;
+
+	HDS_LOG(logInfo) << "Trying to connect in " << logPrecision(1) << (double) delayMs / 1000.0 << " seconds";
+	retryTimer.expires_after(std::chrono::milliseconds(delayMs));
+	retryTimer.async_wait(boost::bind(&poolConnection::handleRetry, this, boost::asio::placeholders::error));
+}
+
+
+void poolConnection::handleRetry(const boost::system::error_code& err) {
+	if (err) return;
+	start();
+}
+
+
+// Keep the TLS session for the next connect. With TLS 1.3 the server sends the session
+// ticket after the handshake, it is there once the login reply was read. The session is
+// kept serialized: OpenSSL marks a session object as not resumable when its connection
+// is not shut down cleanly, which is the normal case for a lost pool.
+void poolConnection::storeSession() {
+	if (!useTLS || !socket) return;
+
+	SSL_SESSION* session = SSL_get1_session(socket->stream.native_handle());
+	if (session == NULL) return;
+
+	int len = i2d_SSL_SESSION(session, NULL);
+	if (len > 0) {
+		tlsSession.resize(len);
+		uint8_t* data = tlsSession.data();
+		i2d_SSL_SESSION(session, &data);
+	}
+	SSL_SESSION_free(session);
+}
+
+
+// Offer the stored session in a new handshake
+void poolConnection::offerSession(SSL* ssl) {
+	if (tlsSession.size() == 0) return;
+
+	const uint8_t* data = tlsSession.data();
+	SSL_SESSION* session = d2i_SSL_SESSION(NULL, &data, tlsSession.size());
+	if (session == NULL) return;
+
+	SSL_set_session(ssl, session);
+	SSL_SESSION_free(session);
+}
+
+
+// The owner got the login reply, the connection is complete
+void poolConnection::loginDone() {
+	failures = 0;
+	deadlineTimer.cancel();
+	storeSession();
+
+	auto now = std::chrono::steady_clock::now();
+	times.dnsMs = msSince(tStart, tResolved);
+	times.tcpMs = msSince(tResolved, tConnected);
+	times.tlsMs = msSince(tConnected, tHandshake);
+	times.loginMs = msSince(tHandshake, now);
+
+	logLine line(logInfo);
+	line << "Connected to " << name() << " (" << remote << ") in " << logPrecision(1) << msSince(tStart, now) << " ms - DNS: "
+	     << times.dnsMs << " ms" << (times.dnsCached ? " (cached)" : "") << ", TCP: " << times.tcpMs << " ms, TLS: ";
+	if (useTLS) {
+		line << times.tlsMs << " ms" << (times.tlsResumed ? " (resumed)" : "");
+	} else {
+		line << "off";
+	}
+	line << ", login: " << times.loginMs << " ms";
+
+	if (!useTLS && !remote.address().is_loopback() && !isPrivate(remote.address())) {
+		HDS_LOG(logWarning) << "Warning: " << name() << " is no local address, but the connection is not encrypted";
+	}
+}
+
+
+bool poolConnection::isConnected() {
+	return established;
+}
+
+
+string poolConnection::name() {
+	return host + ":" + port;
+}
+
+
+connectionTimes poolConnection::lastTimes() {
+	return times;
+}
+
+
+void poolConnection::setHandlers(std::function<void()> onConnected, std::function<void(const string&)> onLine, std::function<void()> onDisconnected) {
+	connectedHandler = onConnected;
+	lineHandler = onLine;
+	disconnectedHandler = onDisconnected;
+}
+
+
+poolConnection::poolConnection(boost::asio::io_service& ios, boost::asio::ssl::context& ctx, string hostIn, string portIn, bool debugIn, bool useTLSIn)
+	: io_service(ios), context(ctx), res(ios), dialTimer(ios), deadlineTimer(ios), retryTimer(ios) {
+
+	host = hostIn;
+	port = portIn;
+	debug = debugIn;
+	useTLS = useTLSIn;
+
+	random_device rd;
+	rng.seed(rd());
+}
+
+
+} // End namespace hdsMiner
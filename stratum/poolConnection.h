@@ -0,0 +1,149 @@
+// HDS OpenCL Miner
+// Asynchronous connection to a stratum server
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <iomanip>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include "hdsLog.h"
+
+#ifndef poolConnection_H
+#define poolConnection_H
+
+using namespace std;
+using boost::asio::ip::tcp;
+
+namespace hdsMiner {
+
+// How long the steps of the last successful connect took, in milliseconds
+struct connectionTimes {
+	double dnsMs = 0;
+	double tcpMs = 0;
+	double tlsMs = 0;
+	double loginMs = 0;
+	bool dnsCached = false;
+	bool tlsResumed = false;
+};
+
+// One connection to a stratum server. Resolving, dialing and the TLS handshake run asynchronously
+// on the io_service of the owner, failed or lost connections are retried with a jittered exponential
+// backoff. All functions must be called from the thread running the io_service.
+// Without TLS the plain socket below the TLS stream is used.
+class poolConnection {
+	private:
+	// Socket and buffers of one connect attempt. Pending handlers hold a reference,
+	// so a closed connection is released only after its last handler ran.
+	struct connectionData {
+		boost::asio::ssl::stream<tcp::socket> stream;
+		boost::asio::streambuf requestBuffer;
+		boost::asio::streambuf responseBuffer;
+		connectionData(boost::asio::io_service& ios, boost::asio::ssl::context& ctx) : stream(ios, ctx) {}
+	};
+	typedef std::shared_ptr<connectionData> connPtr;
+
+	boost::asio::io_service &io_service;
+	boost::asio::ssl::context &context;
+	tcp::resolver res;
+	string host;
+	string port;
+	bool debug;
+	bool useTLS;
+
+	// Session of the last login, reconnects offer it to the server to skip the full handshake
+	std::vector<uint8_t> tlsSession;
+	void storeSession();
+	void offerSession(SSL*);
+
+	// Handlers of the owner
+	std::function<void()> connectedHandler;
+	std::function<void(const string&)> lineHandler;
+	std::function<void()> disconnectedHandler;
+
+	// Every connect attempt gets a new generation, handlers of older attempts are ignored
+	uint64_t generation = 0;
+	bool established = false;
+	connPtr socket;
+	std::deque<string> writeRequests;
+	bool activeWrite = false;
+
+	// Resolved endpoints are shared by all connections of the process
+	struct dnsEntry {
+		std::vector<tcp::endpoint> endpoints;
+		std::chrono::steady_clock::time_point resolved;
+	};
+	static std::map<string, dnsEntry> dnsCache;
+	static boost::mutex dnsMutex;
+	static constexpr uint32_t dnsCacheSec = 300;
+	bool cachedEndpoints(std::vector<tcp::endpoint>&, bool);
+	void storeEndpoints(const std::vector<tcp::endpoint>&);
+	void dropEndpoints();
+
+	// Happy eyeballs: the endpoints are dialed in parallel with a small stagger, the first one wins
+	std::vector<tcp::endpoint> dialList;
+	std::vector<connPtr> attempts;
+	uint32_t nextAttempt = 0;
+	uint32_t failedAttempts = 0;
+	boost::asio::steady_timer dialTimer;
+	static constexpr uint32_t dialStaggerMs = 250;
+	void dial(std::vector<tcp::endpoint>);
+	void startAttempt(uint64_t);
+	void handleDialTimer(const boost::system::error_code&, uint64_t);
+	void handleDial(const boost::system::error_code&, uint32_t, uint64_t, connPtr);
+
+	// The whole connect, up to the login, must finish in time
+	boost::asio::steady_timer deadlineTimer;
+	static constexpr uint32_t connectTimeoutSec = 15;
+	void handleDeadline(const boost::system::error_code&, uint64_t);
+
+	// Retry with backoff
+	uint32_t failures = 0;
+	std::default_random_engine rng;
+	boost::asio::steady_timer retryTimer;
+	static constexpr uint32_t backoffBaseMs = 1000;
+	static constexpr uint32_t backoffMaxMs = 60000;
+	void fail(string);
+	void handleRetry(const boost::system::error_code&);
+
+	// Latency measurement
+	std::chrono::steady_clock::time_point tStart, tResolved, tConnected, tHandshake;
+	connectionTimes times;
+	tcp::endpoint remote;
+
+	void handleResolve(const boost::system::error_code&, tcp::resolver::iterator, uint64_t);
+	void handleHandshake(const boost::system::error_code&, uint64_t, connPtr);
+	void handleRead(const boost::system::error_code&, uint64_t, connPtr);
+	void activateWrite();
+	void handleWrite(const boost::system::error_code&, uint64_t, connPtr);
+	void resetSocket();
+
+	public:
+	poolConnection(boost::asio::io_service&, boost::asio::ssl::context&, string, string, bool, bool);
+	void setHandlers(std::function<void()>, std::function<void(const string&)>, std::function<void()>);
+
+	void start();
+	void send(string);
+	void close(string);
+	void loginDone();
+
+	bool isConnected();
+	string name();
+	connectionTimes lastTimes();
+};
+
+}
+
+#endif
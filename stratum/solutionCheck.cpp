@@ -0,0 +1,151 @@
+// HDS OpenCL Miner
+// Verification of solutions on the CPU
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <cstring>
+#include <set>
+
+#include "solutionCheck.h"
+#include "crypto/blake2b.h"
+
+namespace hdsMiner {
+
+/*
+	The element of a subtree as the kernels in hds_hash_III.cl hold it: the work bits followed by the
+	indices of the subtree with 25 bits each. Before every round the mixer over the first 512 of these
+	bits replaces the lowest 64 work bits, the round then matches the lowest 24 bits.
+*/
+
+namespace {
+
+	const uint32_t indexBits = 25;
+	const uint32_t collisionBits = 24;
+
+	uint64_t rotl(uint64_t x, uint32_t r) {
+		return (r == 0) ? x : ((x << r) | (x >> (64 - r)));
+	}
+
+	#define SIPROUND 							\
+		v0 += v1; v2 += v3; 						\
+		v1 = rotl(v1, 13); v3 = rotl(v3, 16); 				\
+		v1 ^= v0; v3 ^= v2; 						\
+		v0 = rotl(v0, 32); 						\
+		v2 += v1; v0 += v3; 						\
+		v1 = rotl(v1, 17); v3 = rotl(v3, 21); 				\
+		v1 ^= v2; v3 ^= v0; 						\
+		v2 = rotl(v2, 32);
+
+	// SipHash-2-4 keyed directly with the four prePow words, as sipHash24 of the kernels
+	uint64_t sipHash24(const uint64_t prePow[4], uint64_t nonce) {
+		uint64_t v0 = prePow[0], v1 = prePow[1], v2 = prePow[2], v3 = prePow[3] ^ nonce;
+
+		SIPROUND; SIPROUND;
+		v0 ^= nonce;
+		v2 ^= 0xff;
+		SIPROUND; SIPROUND; SIPROUND; SIPROUND;
+		return (v0 ^ v1 ^ v2 ^ v3);
+	}
+
+	#undef SIPROUND
+
+	struct stepElem {
+		uint64_t work[7];		// Bits above workLen are zero
+		uint32_t workLen;
+		std::vector<uint32_t> indices;
+
+		// Writes len bits of value at bit pos of the 512 bit row, bits beyond the row are dropped
+		static void putBits(uint64_t row[8], uint32_t pos, uint64_t value, uint32_t len) {
+			if (pos >= 512) return;
+			row[pos / 64] |= value << (pos % 64);
+			if ((pos % 64) + len > 64 && (pos / 64) < 7) row[pos / 64 + 1] |= value >> (64 - (pos % 64));
+		}
+
+		void mix() {
+			uint64_t row[8] = {0};
+			memcpy(row, work, sizeof(work));
+			for (uint32_t i=0; i<indices.size(); i++) putBits(row, workLen + i*indexBits, indices[i], indexBits);
+
+			uint64_t result = 0;
+			for (uint32_t i=0; i<8; i++) result += rotl(row[i], (29*(i+1)) & 0x3F);
+			work[0] = rotl(result, 24);
+		}
+
+		// Keeps the lowest len work bits
+		void truncate(uint32_t len) {
+			for (uint32_t i=0; i<7; i++) {
+				if (64*i >= len) {
+					work[i] = 0;
+				} else if (64*(i+1) > len) {
+					work[i] &= (((uint64_t) 1) << (len - 64*i)) - 1;
+				}
+			}
+			workLen = len;
+		}
+
+		// Seed element of one index
+		stepElem(const uint64_t prePow[4], uint32_t index) : workLen(448), indices(1, index) {
+			for (uint32_t i=0; i<7; i++) work[i] = sipHash24(prePow, (((uint64_t) index) << 3) + i);
+			mix();
+		}
+
+		// Element of the next round from two matching ones, a holds the smaller first index
+		stepElem(const stepElem &a, const stepElem &b) : indices(a.indices) {
+			indices.insert(indices.end(), b.indices.begin(), b.indices.end());
+			for (uint32_t i=0; i<7; i++) work[i] = a.work[i] ^ b.work[i];
+			for (uint32_t i=0; i<7; i++) {
+				work[i] = (work[i] >> collisionBits) | ((i < 6) ? (work[i+1] << (64 - collisionBits)) : 0);
+			}
+			workLen = a.workLen - collisionBits;
+			mix();
+		}
+
+		bool collides(const stepElem &other, uint32_t bits) const {
+			uint64_t mask = (((uint64_t) 1) << bits) - 1;
+			return ((work[0] ^ other.work[0]) & mask) == 0;
+		}
+	};
+}
+
+
+bool validHdsIII(const uint64_t work[4], uint64_t nonce, const std::vector<uint8_t>& compressed) {
+	if (compressed.size() != 104) return false;
+
+	// The prePow is the Blake2b of the work, the nonce and the extra nonce behind the indices
+	uint8_t msg[44];
+	uint64_t prePow[4];
+	memcpy(&msg[0], work, 32);
+	memcpy(&msg[32], &nonce, 8);
+	memcpy(&msg[40], &compressed[100], 4);
+	blake2bEquihashBatch(msg, sizeof(msg), 1, 32, 448, 5, (uint8_t*) prePow);
+
+	std::vector<uint32_t> indices = GetIndicesFromMinimal(compressed);
+	if (std::set<uint32_t>(indices.begin(), indices.end()).size() != indices.size()) return false;
+
+	std::vector<stepElem> X;
+	X.reserve(indices.size());
+	for (uint32_t index : indices) X.emplace_back(prePow, index);
+
+	for (uint32_t round = 1; X.size() > 1; round++) {
+		std::vector<stepElem> next;
+		next.reserve(X.size() / 2);
+
+		for (size_t i=0; i<X.size(); i+=2) {
+			if (X[i].indices[0] >= X[i+1].indices[0]) return false;
+
+			// The last round matches the 24 bits of the round and the 24 bits above them
+			if (round == 5) return X[i].collides(X[i+1], 2*collisionBits);
+			if (!X[i].collides(X[i+1], collisionBits)) return false;
+
+			next.emplace_back(X[i], X[i+1]);
+
+			// After the mix for round 4 the kernels only keep 312 work bits
+			if (round == 3) next.back().truncate(312);
+		}
+		X.swap(next);
+	}
+
+	return false;
+}
+
+}
@@ -0,0 +1,23 @@
+// HDS OpenCL Miner
+// Verification of solutions on the CPU
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <vector>
+#include <cstdint>
+
+#ifndef solutionCheck_H
+#define solutionCheck_H
+
+namespace hdsMiner {
+
+// Checks a compressed Hds Hash III solution of 104 bytes (32 indices of 25 bits and the extra nonce)
+// for the work and nonce it was mined on: all indices distinct, each subtree ordered by its first
+// index, the 24 bit collisions of rounds 1 to 4 and the final 48 bit collision. The target is not checked.
+bool validHdsIII(const uint64_t work[4], uint64_t nonce, const std::vector<uint8_t>& compressed);
+
+std::vector<uint32_t> GetIndicesFromMinimal(std::vector<uint8_t> soln);
+
+}
+
+#endif
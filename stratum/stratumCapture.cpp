@@ -0,0 +1,115 @@
+// HDS OpenCL Miner
+// Binary capture of stratum sessions
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "stratumCapture.h"
+
+namespace hdsMiner {
+
+static const char captureMagic[8] = {'H','D','S','C','A','P','1','\n'};
+
+
+bool stratumCaptureWriter::open(const string& fileName) {
+	file.open(fileName, ios::out | ios::binary | ios::trunc);
+	if (!file) return false;
+
+	uint64_t startMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	file.write(captureMagic, sizeof(captureMagic));
+	for (uint32_t i=0; i<8; i++) file.put((char) ((startMs >> (8*i)) & 0xFF));
+	file.flush();
+
+	last = std::chrono::steady_clock::now();
+	return true;
+}
+
+
+bool stratumCaptureWriter::isOpen() {
+	return file.is_open();
+}
+
+
+void stratumCaptureWriter::writeVarint(uint64_t value) {
+	while (value >= 0x80) {
+		file.put((char) ((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	file.put((char) value);
+}
+
+
+void stratumCaptureWriter::record(uint32_t pool, bool outbound, const string& line) {
+	if (!file.is_open()) return;
+
+	auto now = std::chrono::steady_clock::now();
+	writeVarint(std::chrono::duration_cast<std::chrono::microseconds>(now - last).count());
+	last = now;
+
+	// Lines are stored without their trailing newline
+	size_t length = line.size();
+	while ((length > 0) && ((line[length-1] == '\n') || (line[length-1] == '\r') || (line[length-1] == ' '))) length--;
+
+	file.put((char) ((outbound ? 0x80 : 0) | (pool & 0x7F)));
+	writeVarint(length);
+	file.write(line.data(), length);
+
+	// The miner has no clean shutdown, so every record goes to disk at once
+	file.flush();
+}
+
+
+bool stratumCaptureReader::open(const string& fileName) {
+	file.open(fileName, ios::in | ios::binary);
+	if (!file) return false;
+
+	char magic[8];
+	if (!file.read(magic, sizeof(magic)) || (string(magic, 8) != string(captureMagic, 8))) return false;
+
+	startMs = 0;
+	for (uint32_t i=0; i<8; i++) {
+		int c = file.get();
+		if (c == EOF) return false;
+		startMs |= ((uint64_t) (uint8_t) c) << (8*i);
+	}
+
+	timeUs = 0;
+	return true;
+}
+
+
+bool stratumCaptureReader::readVarint(uint64_t& value) {
+	value = 0;
+	for (uint32_t shift = 0; shift < 64; shift += 7) {
+		int c = file.get();
+		if (c == EOF) return false;
+		value |= ((uint64_t) (c & 0x7F)) << shift;
+		if ((c & 0x80) == 0) return true;
+	}
+	return false;
+}
+
+
+// Returns false at the end of the file, a truncated last record counts as end
+bool stratumCaptureReader::next(captureRecord& rec) {
+	uint64_t delta, length;
+	if (!readVarint(delta)) return false;
+
+	int flags = file.get();
+	if ((flags == EOF) || !readVarint(length)) return false;
+
+	rec.line.resize(length);
+	if ((length > 0) && !file.read(&rec.line[0], length)) return false;
+
+	timeUs += delta;
+	rec.timeUs = timeUs;
+	rec.pool = flags & 0x7F;
+	rec.outbound = (flags & 0x80) != 0;
+	return true;
+}
+
+
+uint64_t stratumCaptureReader::startTime() {
+	return startMs;
+}
+
+}
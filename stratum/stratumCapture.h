@@ -0,0 +1,59 @@
+// HDS OpenCL Miner
+// Binary capture of stratum sessions
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <string>
+#include <fstream>
+#include <chrono>
+#include <cstdint>
+
+#ifndef stratumCapture_H
+#define stratumCapture_H
+
+using namespace std;
+
+namespace hdsMiner {
+
+// File layout: the 8 byte magic "HDSCAP1\n", the start time as 8 byte little endian
+// unix time in milliseconds, then one record per stratum line:
+//   varint   microseconds since the previous record (steady clock)
+//   uint8    bit 7 set for lines sent by the miner, bits 0-6 index of the pool
+//   varint   length of the line, followed by the line without the newline
+struct captureRecord {
+	uint64_t timeUs = 0;		// Since the start of the capture
+	uint32_t pool = 0;
+	bool outbound = false;
+	string line;
+};
+
+// Appends stratum lines to a capture file. Not thread safe, the stratum thread is the only user.
+class stratumCaptureWriter {
+	private:
+	ofstream file;
+	std::chrono::steady_clock::time_point last;
+	void writeVarint(uint64_t);
+
+	public:
+	bool open(const string&);
+	bool isOpen();
+	void record(uint32_t, bool, const string&);
+};
+
+// Reads a capture file record by record
+class stratumCaptureReader {
+	private:
+	ifstream file;
+	uint64_t startMs = 0;
+	uint64_t timeUs = 0;
+	bool readVarint(uint64_t&);
+
+	public:
+	bool open(const string&);
+	bool next(captureRecord&);
+	uint64_t startTime();
+};
+
+}
+
+#endif
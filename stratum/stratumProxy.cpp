@@ -0,0 +1,440 @@
+// HDS OpenCL Miner
+// Stratum proxy, serves the jobs of one upstream session to many downstream miners
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include "stratumProxy.h"
+#include "solutionCheck.h"
+
+namespace hdsMiner {
+
+static string toHex(const uint8_t* data, size_t length) {
+	static const char digits[] = "0123456789abcdef";
+	string result;
+	for (size_t i=0; i<length; i++) {
+		result.push_back(digits[data[i] >> 4]);
+		result.push_back(digits[data[i] & 0xF]);
+	}
+	return result;
+}
+
+
+static bool fromHex(const string& input, std::vector<uint8_t>& result) {
+	if (input.length() % 2 != 0) return false;
+	result.clear();
+	for (size_t i = 0; i < input.length(); i += 2) {
+		char* end;
+		string byte = input.substr(i, 2);
+		result.push_back((uint8_t) strtoul(byte.c_str(), &end, 16));
+		if (*end != 0) return false;
+	}
+	return true;
+}
+
+
+void proxySession::start() {
+	read();
+}
+
+
+void proxySession::read() {
+	boost::asio::async_read_until(socket, responseBuffer, "\n",
+		strand.wrap(boost::bind(&proxySession::handleRead, shared_from_this(), boost::asio::placeholders::error)));
+}
+
+
+void proxySession::handleRead(const boost::system::error_code& err) {
+	if (err) {
+		doClose();
+		return;
+	}
+
+	std::istream is(&responseBuffer);
+	string line;
+	getline(is, line);
+	if (line.size() > 0) proxy->handleLine(shared_from_this(), line);
+	if (!closed) read();
+}
+
+
+// Can be called from any thread, the message is shared between all sessions it goes to
+void proxySession::send(std::shared_ptr<const string> msg) {
+	auto self = shared_from_this();
+	strand.post([self, msg]() {
+		if (self->closed) return;
+
+		// A miner that does not read its messages is dropped
+		if (self->writeRequests.size() >= 64) {
+			HDS_LOG(logInfo) << "Proxy: miner " << self->id << " does not keep up, disconnecting";
+			self->doClose();
+			return;
+		}
+
+		self->writeRequests.push_back(msg);
+		if (!self->activeWrite) self->activateWrite();
+	});
+}
+
+
+void proxySession::activateWrite() {
+	activeWrite = true;
+	boost::asio::async_write(socket, boost::asio::buffer(*writeRequests.front()),
+		strand.wrap(boost::bind(&proxySession::handleWrite, shared_from_this(), boost::asio::placeholders::error)));
+}
+
+
+void proxySession::handleWrite(const boost::system::error_code& err) {
+	writeRequests.pop_front();
+	if (err) {
+		activeWrite = false;
+		doClose();
+		return;
+	}
+
+	if (writeRequests.empty()) {
+		activeWrite = false;
+	} else {
+		activateWrite();
+	}
+}
+
+
+void proxySession::close() {
+	strand.post(boost::bind(&proxySession::doClose, shared_from_this()));
+}
+
+
+void proxySession::doClose() {
+	if (closed) return;
+	closed = true;
+
+	boost::system::error_code ec;
+	socket.shutdown(tcp::socket::shutdown_both, ec);
+	socket.close(ec);
+	proxy->removeSession(shared_from_this());
+}
+
+
+void stratumProxy::accept() {
+	proxySessionPtr session = std::make_shared<proxySession>(io_service, this, nextSession++);
+	acceptor.async_accept(session->socket,
+		boost::bind(&stratumProxy::handleAccept, this, session, boost::asio::placeholders::error));
+}
+
+
+void stratumProxy::handleAccept(proxySessionPtr session, const boost::system::error_code& err) {
+	if (!err) {
+		boost::system::error_code ec;
+		session->socket.set_option(tcp::no_delay(true), ec);
+		HDS_LOG(logDebug) << "Proxy: miner " << session->id << " connected from " << session->socket.remote_endpoint(ec);
+
+		{
+			boost::mutex::scoped_lock lock(proxyMutex);
+			sessions.push_back(session);
+		}
+		session->start();
+	}
+	accept();
+}
+
+
+void stratumProxy::removeSession(proxySessionPtr session) {
+	boost::mutex::scoped_lock lock(proxyMutex);
+	if (session->slot >= 0) usedSlots.erase(session->slot);
+	sessions.remove(session);
+	HDS_LOG(logDebug) << "Proxy: miner " << session->id << " disconnected";
+}
+
+
+// Hands out the lowest free nonce range and builds the login answer, called with the mutex held.
+// The fork heights make the downstream miner select the solver of the current job.
+string stratumProxy::loginReply(proxySessionPtr session) {
+	uint32_t capacity = 1 << (8*slotBytes);
+	int32_t slot = 0;
+	while ((usedSlots.count(slot) > 0) && (slot < (int32_t) capacity)) slot++;
+	if ((slotBytes == 0) || (slot >= (int32_t) capacity)) return "";
+
+	usedSlots.insert(slot);
+	session->slot = slot;
+	session->prefix = poolPrefix;
+	for (uint32_t i=0; i<slotBytes; i++) session->prefix.push_back((uint8_t) (slot >> (8*i)));
+	session->loggedIn = true;
+	session->loginPending = false;
+
+	uint64_t never = numeric_limits<uint64_t>::max() - 1;
+	uint64_t forkHeight = (solver == HdsI) ? never : 0;
+	uint64_t forkHeight2 = (solver == HdsIII) ? 0 : never;
+
+	stringstream json;
+	json << "{\"method\":\"result\", \"id\":\"login\", \"code\":0, \"nonceprefix\":\"" << toHex(session->prefix.data(), session->prefix.size())
+	     << "\", \"forkheight\":" << forkHeight << ", \"forkheight2\":" << forkHeight2 << ", \"jsonrpc\":\"2.0\"}\n";
+	return json.str();
+}
+
+
+string stratumProxy::buildJobMessage(const JobSnapshot& job) {
+	stringstream json;
+	json << "{\"method\":\"job\", \"id\":\"" << job.epoch << "\", \"input\":\"" << toHex((const uint8_t*) job.work, 32)
+	     << "\", \"difficulty\":" << job.powDiff.m_Packed << ", \"height\":" << job.height << ", \"jsonrpc\":\"2.0\"}\n";
+	return json.str();
+}
+
+
+// Called from the stratum thread for every job the upstream session publishes. The message is built
+// once and shared by all sessions. A new pool nonce prefix or solver needs a new login downstream.
+void stratumProxy::handleJob(uint64_t epoch) {
+	JobSnapshot job = upstream->jobSnapshot();
+	if (job.epoch != epoch) return;	// Replaced in between, the call for the newer job follows
+
+	std::vector< std::pair<proxySessionPtr, std::shared_ptr<const string> > > messages;
+	std::vector<proxySessionPtr> toClose;
+	{
+		boost::mutex::scoped_lock lock(proxyMutex);
+
+		if (job.workId < 0) {
+			if (jobMessage && !jobs.empty()) {
+				stringstream json;
+				json << "{\"method\":\"cancel\", \"id\":\"" << jobs.back().job.epoch << "\", \"jsonrpc\":\"2.0\"}\n";
+				auto cancel = std::make_shared<const string>(json.str());
+				for (auto &session : sessions) {
+					if (session->loggedIn) messages.push_back(std::make_pair(session, cancel));
+				}
+			}
+			jobMessage.reset();
+		} else {
+			std::vector<uint8_t> prefix(job.poolNonce, job.poolNonce + job.poolNonceBytes);
+			bool relogin = (prefix != poolPrefix) || (job.solver != solver);
+			if (relogin) {
+				poolPrefix = prefix;
+				solver = job.solver;
+				slotBytes = min<uint32_t>(2, maxPrefixBytes - min<uint32_t>(prefix.size(), maxPrefixBytes));
+				if (slotBytes == 0) HDS_LOG(logInfo) << "Proxy: the nonce prefix of the pool leaves no room for downstream miners";
+			}
+
+			proxyJob pj;
+			pj.job = job;
+			jobs.push_back(pj);
+			while (jobs.size() > jobHistorySize) jobs.pop_front();
+
+			jobMessage = std::make_shared<const string>(buildJobMessage(job));
+
+			for (auto &session : sessions) {
+				if (session->loggedIn && relogin) {
+					session->loggedIn = false;
+					toClose.push_back(session);
+				} else if (session->loggedIn) {
+					messages.push_back(std::make_pair(session, jobMessage));
+				} else if (session->loginPending) {
+					string reply = loginReply(session);
+					if (reply.size() == 0) {
+						toClose.push_back(session);
+						continue;
+					}
+					messages.push_back(std::make_pair(session, std::make_shared<const string>(reply)));
+					messages.push_back(std::make_pair(session, jobMessage));
+				}
+			}
+		}
+	}
+
+	for (auto &msg : messages) msg.first->send(msg.second);
+	for (auto &session : toClose) session->close();
+
+	if (!toClose.empty()) HDS_LOG(logInfo) << "Proxy: pool nonce prefix or algorithm changed, " << toClose.size() << " miners log in again";
+}
+
+
+// Results of the pool carry the work id only, they are matched in order to the forwarded solutions
+void stratumProxy::handleShareResult(uint32_t pool, int64_t workId, bool acc) {
+	proxySessionPtr session;
+	string reply;
+	{
+		boost::mutex::scoped_lock lock(proxyMutex);
+		for (auto it = pendingShares.begin(); it != pendingShares.end(); ++it) {
+			if ((it->pool != pool) || (it->workId != workId)) continue;
+
+			session = it->session.lock();
+			stringstream json;
+			json << "{\"method\":\"result\", \"id\":\"" << it->jobId << "\", \"code\":" << (acc ? 1 : -1) << ", \"jsonrpc\":\"2.0\"}\n";
+			reply = json.str();
+
+			pendingShares.erase(it);
+			if (acc) {
+				accepted++;
+			} else {
+				rejected++;
+			}
+			break;
+		}
+	}
+
+	if (session) session->send(std::make_shared<const string>(reply));
+}
+
+
+// Local validation of a downstream solution before it goes upstream. The codes follow the pool:
+// 1 forwarded, 0 stale, -1 invalid, -2 duplicate. Called with the mutex held.
+int32_t stratumProxy::checkShare(proxySessionPtr session, pt::iptree& tree, proxyShare& share) {
+	if (!session->loggedIn) return -1;
+
+	uint64_t epoch = 0;
+	try {
+		epoch = stoull(share.jobId);
+	} catch (...) {
+		return -1;
+	}
+
+	proxyJob* pj = NULL;
+	for (auto &j : jobs) {
+		if (j.job.epoch == epoch) pj = &j;
+	}
+	if (pj == NULL) return 0;
+
+	// The nonce must lie in the range of this miner
+	std::vector<uint8_t> nonceBytes, compressed;
+	if (!fromHex(tree.get<string>("nonce", ""), nonceBytes) || (nonceBytes.size() != 8)) return -1;
+	if (!std::equal(session->prefix.begin(), session->prefix.end(), nonceBytes.begin())) return -1;
+
+	// Hds Hash I and II as well as III solutions are 104 bytes
+	if (!fromHex(tree.get<string>("output", ""), compressed) || (compressed.size() != 104)) return -1;
+
+	uint64_t nonce;
+	memcpy(&nonce, nonceBytes.data(), 8);
+
+	// A bad solution would count against the shared upstream session, so HdsHash III solutions are
+	// verified in full. For HdsHash I and II only the target is checked.
+	if ((pj->job.solver == HdsIII) && !validHdsIII(pj->job.work, nonce, compressed)) return -1;
+
+	if (!pj->nonces.insert(nonce).second) return -2;
+
+	WorkDescription wd;
+	wd.epoch = pj->job.epoch;
+	wd.workId = pj->job.workId;
+	wd.nonce = nonce;
+	wd.powDiff = pj->job.powDiff;
+	wd.powTarget = pj->job.powTarget;
+	wd.solver = pj->job.solver;
+
+	int32_t code = upstream->forwardSolution(wd, compressed, share.pool);
+	share.workId = wd.workId;
+	return code;
+}
+
+
+// Called on the strand of the session
+void stratumProxy::handleLine(proxySessionPtr session, const string& line) {
+	HDS_LOG(logDebug) << "Proxy: miner " << session->id << ": " << line;
+
+	pt::iptree tree;
+	try {
+		istringstream jsonStream(line);
+		pt::read_json(jsonStream, tree);
+	} catch (const pt::ptree_error &e) {
+		HDS_LOG(logError) << "Proxy: json parse error from miner " << session->id << ": " << e.what();
+		return;
+	}
+
+	string method = tree.get<string>("method", "");
+	std::vector< std::shared_ptr<const string> > messages;
+	bool refused = false;
+
+	if (method == "login") {
+		boost::mutex::scoped_lock lock(proxyMutex);
+		if (session->loggedIn) return;
+
+		// Without a job the nonce prefix of the pool is not known yet, the login is answered with the first job
+		if (!jobMessage) {
+			session->loginPending = true;
+		} else {
+			string reply = loginReply(session);
+			if (reply.size() > 0) {
+				messages.push_back(std::make_shared<const string>(reply));
+				messages.push_back(jobMessage);
+			} else {
+				refused = true;
+			}
+		}
+	}
+
+	if (method == "solution") {
+		proxyShare share;
+		share.jobId = tree.get<string>("id", "");
+		share.session = session;
+
+		boost::mutex::scoped_lock lock(proxyMutex);
+		int32_t code = checkShare(session, tree, share);
+
+		if (code == 1) {
+			forwarded++;
+			pendingShares.push_back(share);
+			while (pendingShares.size() > maxPendingShares) pendingShares.pop_front();
+		} else {
+			switch (code) {
+				case 0: stale++; break;
+				case -1: invalid++; break;
+				default: duplicate++;
+			}
+
+			stringstream json;
+			json << "{\"method\":\"result\", \"id\":\"" << share.jobId << "\", \"code\":" << code << ", \"jsonrpc\":\"2.0\"}\n";
+			messages.push_back(std::make_shared<const string>(json.str()));
+		}
+	}
+
+	for (auto &msg : messages) session->send(msg);
+
+	if (refused) {
+		HDS_LOG(logInfo) << "Proxy: no free nonce range for miner " << session->id;
+		session->close();
+	}
+}
+
+
+void stratumProxy::handleStatsTimer(const boost::system::error_code& err) {
+	if (err) return;
+
+	{
+		boost::mutex::scoped_lock lock(proxyMutex);
+		HDS_LOG(logInfo) << "Proxy: " << sessions.size() << " miners, solutions forwarded: " << forwarded << " (accepted " << accepted << ", rejected " << rejected
+		                 << "), dropped stale / invalid / duplicate: " << stale << " / " << invalid << " / " << duplicate;
+	}
+
+	statsTimer.expires_after(std::chrono::seconds(60));
+	statsTimer.async_wait(boost::bind(&stratumProxy::handleStatsTimer, this, boost::asio::placeholders::error));
+}
+
+
+// Runs the downstream side on a small thread pool, never returns
+void stratumProxy::run() {
+	accept();
+	statsTimer.expires_after(std::chrono::seconds(60));
+	statsTimer.async_wait(boost::bind(&stratumProxy::handleStatsTimer, this, boost::asio::placeholders::error));
+
+	uint32_t threads = max<uint32_t>(1, min<uint32_t>(4, std::thread::hardware_concurrency()));
+	std::vector<std::thread> pool;
+	for (uint32_t i=1; i<threads; i++) {
+		pool.emplace_back([this]() { io_service.run(); });
+	}
+	io_service.run();
+
+	for (auto &t : pool) t.join();
+}
+
+
+stratumProxy::stratumProxy(hdsStratum* upstreamIn, uint16_t port, bool debugIn) : acceptor(io_service), statsTimer(io_service) {
+	upstream = upstreamIn;
+	debug = debugIn;
+
+	upstream->setJobListener(boost::bind(&stratumProxy::handleJob, this, _1));
+	upstream->setShareListener(boost::bind(&stratumProxy::handleShareResult, this, _1, _2, _3));
+
+	tcp::endpoint endpoint(tcp::v4(), port);
+	acceptor.open(endpoint.protocol());
+	acceptor.set_option(tcp::acceptor::reuse_address(true));
+	acceptor.bind(endpoint);
+	acceptor.listen();
+
+	HDS_LOG(logInfo) << "Proxy: listening for miners on port " << port << " (plain TCP)";
+}
+
+}
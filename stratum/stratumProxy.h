@@ -0,0 +1,146 @@
+// HDS OpenCL Miner
+// Stratum proxy, serves the jobs of one upstream session to many downstream miners
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <list>
+#include <set>
+#include <memory>
+#include <chrono>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "hdsStratum.h"
+
+#ifndef stratumProxy_H
+#define stratumProxy_H
+
+using namespace std;
+using boost::asio::ip::tcp;
+namespace pt = boost::property_tree;
+
+namespace hdsMiner {
+
+class stratumProxy;
+
+// Connection of one downstream miner. Reads and writes of a session run on its strand,
+// the fields below the strand are guarded by the mutex of the proxy.
+class proxySession : public std::enable_shared_from_this<proxySession> {
+	public:
+	tcp::socket socket;
+	boost::asio::io_service::strand strand;
+	boost::asio::streambuf responseBuffer;
+	std::deque< std::shared_ptr<const string> > writeRequests;
+	bool activeWrite = false;
+	bool closed = false;
+
+	uint32_t id;
+	stratumProxy *proxy;
+	bool loggedIn = false;
+	bool loginPending = false;
+	int32_t slot = -1;		// Index of the nonce range of this miner, -1 = none yet
+	std::vector<uint8_t> prefix;	// Nonce prefix handed out at login
+
+	proxySession(boost::asio::io_service& ios, stratumProxy* proxyIn, uint32_t idIn) : socket(ios), strand(ios) {
+		proxy = proxyIn;
+		id = idIn;
+	}
+
+	void start();
+	void send(std::shared_ptr<const string>);
+	void close();
+
+	private:
+	void read();
+	void handleRead(const boost::system::error_code&);
+	void activateWrite();
+	void handleWrite(const boost::system::error_code&);
+	void doClose();
+};
+
+typedef std::shared_ptr<proxySession> proxySessionPtr;
+
+// A job as served downstream, its id is the epoch of the upstream job. The nonces already
+// submitted for it catch duplicates across all downstream miners.
+struct proxyJob {
+	JobSnapshot job;
+	std::set<uint64_t> nonces;
+};
+
+// A forwarded solution waiting for the answer of the pool
+struct proxyShare {
+	uint32_t pool;
+	int64_t workId;
+	string jobId;
+	std::weak_ptr<proxySession> session;
+};
+
+// Accepts downstream miners over plain TCP and keeps one upstream session through hdsStratum.
+// Every downstream miner gets a disjoint nonce prefix below the one of the pool. Solutions are
+// checked against the target and for duplicates before they go upstream, the answer of the pool
+// is passed back to the miner that found the solution.
+class stratumProxy {
+	private:
+	hdsStratum *upstream;
+	bool debug;
+	boost::asio::io_service io_service;
+	tcp::acceptor acceptor;
+	boost::asio::steady_timer statsTimer;
+
+	boost::mutex proxyMutex;
+	std::list<proxySessionPtr> sessions;
+	uint32_t nextSession = 0;
+
+	// Nonce partitioning: the prefix of the pool plus slotBytes bytes for the downstream miner
+	std::vector<uint8_t> poolPrefix;
+	uint32_t slotBytes = 2;
+	std::set<int32_t> usedSlots;
+	static constexpr uint32_t maxPrefixBytes = 6;
+
+	// Jobs and forwarded solutions
+	std::deque<proxyJob> jobs;
+	std::shared_ptr<const string> jobMessage;
+	solverType solver = None;
+	static constexpr uint32_t jobHistorySize = 8;
+	std::deque<proxyShare> pendingShares;
+	static constexpr uint32_t maxPendingShares = 1024;
+
+	// Statistics
+	uint64_t forwarded = 0;
+	uint64_t accepted = 0;
+	uint64_t rejected = 0;
+	uint64_t stale = 0;
+	uint64_t invalid = 0;
+	uint64_t duplicate = 0;
+
+	void accept();
+	void handleAccept(proxySessionPtr, const boost::system::error_code&);
+	void handleJob(uint64_t);
+	void handleShareResult(uint32_t, int64_t, bool);
+	string loginReply(proxySessionPtr);
+	string buildJobMessage(const JobSnapshot&);
+	int32_t checkShare(proxySessionPtr, pt::iptree&, proxyShare&);
+	void handleStatsTimer(const boost::system::error_code&);
+
+	public:
+	stratumProxy(hdsStratum*, uint16_t, bool);
+	void run();
+
+	void handleLine(proxySessionPtr, const string&);
+	void removeSession(proxySessionPtr);
+	bool debugMode() { return debug; }
+};
+
+}
+
+#endif
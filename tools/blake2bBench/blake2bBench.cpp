@@ -0,0 +1,125 @@
+// HDS OpenCL Miner
+// Benchmark of the batch Blake2b
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+// Compares every hash of blake2bEquihashBatch and of the AVX2 and AVX-512 kernels the CPU supports
+// with blake2bInstance for random 44 byte messages, batch sizes, strides and Equihash parameters,
+// then times the scalar class against the batch.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+
+#include "crypto/blake2b.h"
+#include "crypto/blake2b_x86.h"
+
+using namespace std;
+
+namespace {
+
+	const uint32_t msgLen = 44;
+
+	void reference(const uint8_t *msg, uint8_t hashLen, uint32_t n, uint32_t k, uint8_t *out) {
+		uint8_t block[128] = {0};
+		memcpy(block, msg, msgLen);
+
+		blake2bInstance inst;
+		inst.init(hashLen, n, k, "Hds--PoW");
+		inst.update(block, msgLen, 1);
+		inst.ret_final(out, hashLen);
+	}
+
+	// Checks count hashes at out against the class, returns the number of wrong ones
+	uint64_t compare(const vector<uint8_t> &msgs, size_t stride, size_t count, uint8_t hashLen, uint32_t n, uint32_t k, const uint8_t *out) {
+		uint64_t wrong = 0;
+		uint8_t expected[64];
+		for (size_t i=0; i<count; i++) {
+			reference(&msgs[i*stride], hashLen, n, k, expected);
+			if (memcmp(expected, out + i*hashLen, hashLen) != 0) wrong++;
+		}
+		return wrong;
+	}
+}
+
+
+int main(int argc, char* argv[]) {
+	uint32_t rounds = (argc > 1) ? stoul(argv[1]) : 10000;
+	mt19937_64 rng(12345);
+
+	cout << "Batch implementation: " << blake2bImplementation() << endl;
+
+#ifdef BLAKE2B_X86
+	bool avx2 = blake2bHasAvx2();
+	bool avx512 = blake2bHasAvx512();
+#endif
+
+	// Equivalence
+	uint64_t checks = 0;
+	uint64_t mismatches = 0;
+	for (uint32_t r=0; r<rounds; r++) {
+		size_t count = rng() % 21;
+		size_t stride = msgLen + (rng() % 3) * (rng() % 23);
+		uint8_t hashLen = 1 + (rng() % 64);
+		uint32_t n = 96 + (rng() % 400);
+		uint32_t k = 3 + (rng() % 6);
+
+		vector<uint8_t> msgs(stride * max<size_t>(count, 8) + msgLen);
+		for (auto &b : msgs) b = (uint8_t) rng();
+		vector<uint8_t> out(64 * max<size_t>(count, 8));
+
+		blake2bEquihashBatch(msgs.data(), stride, count, hashLen, n, k, out.data());
+		checks += count;
+		mismatches += compare(msgs, stride, count, hashLen, n, k, out.data());
+
+#ifdef BLAKE2B_X86
+		// The kernels directly, so a CPU with AVX-512 tests the AVX2 one as well
+		blake2bInstance param;
+		param.init(hashLen, n, k, "Hds--PoW");
+		uint64_t h[8];
+		param.ret_state(h);
+
+		if (avx2) {
+			blake2bEquihash4_Avx2(h, msgs.data(), stride, hashLen, out.data());
+			checks += 4;
+			mismatches += compare(msgs, stride, 4, hashLen, n, k, out.data());
+		}
+		if (avx512) {
+			blake2bEquihash8_Avx512(h, msgs.data(), stride, hashLen, out.data());
+			checks += 8;
+			mismatches += compare(msgs, stride, 8, hashLen, n, k, out.data());
+		}
+#endif
+
+		if (mismatches > 0) {
+			cout << "Mismatch for " << count << " messages, stride " << stride << ", hash length " << (uint32_t) hashLen
+			     << ", n " << n << ", k " << k << endl;
+			return 1;
+		}
+	}
+	cout << checks << " hashes checked, all agree with blake2bInstance" << endl;
+
+	// Speed, on the HdsHash III parameters
+	const size_t count = 4096;
+	vector<uint8_t> msgs(count * msgLen);
+	for (auto &b : msgs) b = (uint8_t) rng();
+	vector<uint8_t> out(count * 32);
+
+	const uint32_t repeats = 200;
+	auto start = chrono::steady_clock::now();
+	for (uint32_t r=0; r<repeats; r++) {
+		for (size_t i=0; i<count; i++) reference(&msgs[i*msgLen], 32, 448, 5, &out[i*32]);
+	}
+	double scalarNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (repeats * count);
+
+	start = chrono::steady_clock::now();
+	for (uint32_t r=0; r<repeats; r++) blake2bEquihashBatch(msgs.data(), msgLen, count, 32, 448, 5, out.data());
+	double batchNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (repeats * count);
+
+	cout << fixed << setprecision(1);
+	cout << "blake2bInstance: " << scalarNs << " ns per hash" << endl;
+	cout << "Batch:           " << batchNs << " ns per hash" << endl;
+	return 0;
+}
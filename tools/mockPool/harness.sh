@@ -0,0 +1,73 @@
+#!/bin/bash
+# HDS OpenCL Miner
+# End to end latency check of the miner against the mock pool, runs offline
+# (a CPU OpenCL runtime like pocl is enough).
+#
+# Usage: harness.sh <miner> <mockPool> [seconds] [script] [extra miner parameters]
+# Prints the job to first kernel latency, the share round trip time and the stale rate.
+# With FAILOVER=1 a second mock pool on PORT+1 is the failover pool, the first one is killed halfway
+# and the run fails when a GPU paused during the switch.
+
+MINER=$1
+MOCK=$2
+DURATION=${3:-120}
+SCRIPT=$4
+shift $(( $# < 4 ? $# : 4 ))
+EXTRA="$@"
+
+if [ ! -x "$MINER" ] || [ ! -x "$MOCK" ]; then
+	echo "Usage: harness.sh <miner> <mockPool> [seconds] [script] [extra miner parameters]"
+	exit 1
+fi
+
+PORT=${PORT:-17555}
+OUT=$(mktemp -d)
+
+MOCK_ARGS="--port $PORT --duration $((DURATION + 5)) --record $OUT/shares.csv"
+if [ -n "$SCRIPT" ]; then MOCK_ARGS="$MOCK_ARGS --script $SCRIPT"; fi
+
+"$MOCK" $MOCK_ARGS > "$OUT/mock.log" 2>&1 &
+MOCK_PID=$!
+SERVERS=127.0.0.1:$PORT
+
+if [ "$FAILOVER" = "1" ]; then
+	FAILOVER_ARGS="--port $((PORT + 1)) --duration $((DURATION + 5)) --record $OUT/failoverShares.csv"
+	if [ -n "$SCRIPT" ]; then FAILOVER_ARGS="$FAILOVER_ARGS --script $SCRIPT"; fi
+	"$MOCK" $FAILOVER_ARGS > "$OUT/failoverMock.log" 2>&1 &
+	FAILOVER_PID=$!
+	SERVERS=$SERVERS,127.0.0.1:$((PORT + 1))
+fi
+sleep 1
+
+# The statistics of the miner need --debug, they are printed every 15 seconds
+"$MINER" --server $SERVERS --key harness --allowCPU --debug $EXTRA > "$OUT/miner.log" 2>&1 &
+MINER_PID=$!
+
+if [ "$FAILOVER" = "1" ]; then
+	sleep $((DURATION / 2))
+	kill $MOCK_PID 2>/dev/null
+	sleep $((DURATION - DURATION / 2))
+	kill $MINER_PID 2>/dev/null
+	wait $FAILOVER_PID
+else
+	sleep "$DURATION"
+	kill $MINER_PID 2>/dev/null
+	wait $MOCK_PID
+fi
+
+echo "Job to first kernel:"
+grep "job to first kernel" "$OUT/miner.log" | sed 's/^/  /'
+echo "Share round trip:"
+grep -o "Round trip: [0-9.]* ms" "$OUT/miner.log" | tail -1 | sed 's/^/  /'
+echo "Mock pool:"
+grep "^Shares:" "$OUT/mock.log" | tail -1 | sed 's/^/  /'
+if [ "$FAILOVER" = "1" ]; then
+	echo "Failover pool:"
+	grep "^Shares:" "$OUT/failoverMock.log" | tail -1 | sed 's/^/  /'
+fi
+echo "Logs and recorded shares are in $OUT"
+
+if [ "$FAILOVER" = "1" ] && grep -q "paused" "$OUT/miner.log"; then
+	echo "Failover: a GPU paused while the miner switched pools"
+	exit 1
+fi
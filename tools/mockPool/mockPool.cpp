@@ -0,0 +1,830 @@
+// HDS OpenCL Miner
+// Mock stratum server for offline tests of the miner
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+// Speaks the stratum dialect of the HDS node (login, job, cancel, result) over TLS or plain TCP.
+// Jobs are sent in a fixed interval, follow a script or replay a capture of the miner (--capture),
+// every submitted solution is checked against the target of its job and can be recorded to a CSV file.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <list>
+#include <memory>
+#include <chrono>
+#include <random>
+#include <ctime>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/bind.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+#include "core/difficulty.h"
+#include "crypto/sha256.h"
+#include "stratum/stratumCapture.h"
+
+using namespace std;
+using boost::asio::ip::tcp;
+namespace pt = boost::property_tree;
+
+namespace hdsMiner {
+
+struct mockConfig {
+	uint16_t port = 17000;
+	bool useTLS = true;
+	uint32_t intervalMs = 10000;	// Job cadence without script
+	uint32_t difficulty = 0;	// Packed difficulty of the jobs
+	bool forceDifficulty = false;	// Replayed jobs keep their difficulty unless one is given
+	uint32_t staleGraceMs = 0;	// Solutions for the previous job are accepted this long after a new job
+	uint32_t durationSec = 0;	// Stop after this time, 0 = run until interrupted
+	uint64_t forkHeight2 = 0;	// HdsHash III fork height sent at login, the jobs start at height 1000
+	string noncePrefix;
+	string scriptFile;
+	string recordFile;
+	string replayFile;
+	uint32_t replayPool = 0;	// Pool index of the capture that is replayed
+	double speed = 1.0;		// Replay speed factor
+	bool debug = false;
+};
+
+// One step of a job script: wait delayMs, then run the command
+struct scriptStep {
+	uint32_t delayMs;
+	string command;
+	uint32_t value;
+};
+
+// A job as sent to the miners
+struct mockJob {
+	string id;
+	uint64_t height;
+	string input;
+	hds::Difficulty difficulty;
+	hds::Difficulty::Target target;
+	std::chrono::steady_clock::time_point sent;
+	std::chrono::steady_clock::time_point replaced;
+	bool canceled = false;
+};
+
+inline double msSince(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+vector<uint8_t> parseHex(string input) {
+	vector<uint8_t> result;
+	for (uint32_t i = 0; i + 1 < input.length(); i += 2) {
+		result.push_back((uint8_t) stoul(input.substr(i, 2), nullptr, 16));
+	}
+	return result;
+}
+
+class mockPool;
+
+// Connection of one miner
+class mockSession : public std::enable_shared_from_this<mockSession> {
+	public:
+	typedef boost::asio::ssl::stream<tcp::socket> sslStream;
+
+	sslStream stream;
+	boost::asio::streambuf responseBuffer;
+	std::deque<string> writeRequests;
+	boost::asio::streambuf requestBuffer;
+	bool activeWrite = false;
+	bool loggedIn = false;
+	bool closed = false;
+	uint32_t id;
+	mockPool *pool;
+
+	mockSession(boost::asio::io_service& ios, boost::asio::ssl::context& ctx, mockPool* poolIn, uint32_t idIn) : stream(ios, ctx) {
+		pool = poolIn;
+		id = idIn;
+	}
+
+	void start();
+	void send(string);
+	void close();
+
+	private:
+	void handleHandshake(const boost::system::error_code&);
+	void read();
+	void handleRead(const boost::system::error_code&);
+	void activateWrite();
+	void handleWrite(const boost::system::error_code&);
+};
+
+typedef std::shared_ptr<mockSession> sessionPtr;
+
+
+class mockPool {
+	public:
+	mockPool(mockConfig);
+	void run();
+
+	void handleLine(sessionPtr, const string&);
+	void removeSession(sessionPtr);
+	bool useTLS() { return config.useTLS; }
+	bool debug() { return config.debug; }
+
+	private:
+	mockConfig config;
+	boost::asio::io_service io_service;
+	boost::asio::ssl::context context;
+	tcp::acceptor acceptor;
+	boost::asio::steady_timer jobTimer;
+	boost::asio::steady_timer statsTimer;
+	boost::asio::steady_timer stopTimer;
+	boost::asio::signal_set signals;
+	std::list<sessionPtr> sessions;
+	uint32_t nextSession = 0;
+	std::mt19937_64 rng;
+
+	// Job state
+	std::deque<mockJob> jobs;
+	uint64_t nextJobId = 1;
+	uint64_t height = 1000;
+	hds::Difficulty difficulty;
+	std::vector<scriptStep> script;
+	uint32_t scriptPos = 0;
+
+	// Replay of a capture: the pool lines are sent with their original timing divided by the speed.
+	// Results of solutions are not replayed but answered live, a recorded login reply after the
+	// first one disconnects the miners like the original pool did.
+	std::vector<captureRecord> replay;
+	uint32_t replayPos = 0;
+	bool replayStarted = false;
+	std::chrono::steady_clock::time_point replayStart;
+	string loginReply;
+
+	// Share statistics
+	std::set< std::pair<string, string> > seenShares;
+	uint64_t accepted = 0;
+	uint64_t stale = 0;
+	uint64_t invalid = 0;
+	uint64_t duplicate = 0;
+	double shareAgeMs = 0;
+	ofstream record;
+	std::chrono::steady_clock::time_point started;
+
+	void createCertificate();
+	void loadScript();
+	void loadReplay();
+	void startReplay();
+	void handleReplayTimer(const boost::system::error_code&);
+	void replayLine(const string&);
+	void addJob(mockJob&);
+	void accept();
+	void handleAccept(sessionPtr, const boost::system::error_code&);
+	void scheduleNext();
+	void handleJobTimer(const boost::system::error_code&);
+	void runCommand(const string&, uint32_t);
+	void newJob();
+	string jobMessage(const mockJob&);
+	int32_t checkShare(pt::iptree&, string&, double&);
+	void handleStatsTimer(const boost::system::error_code&);
+	void printStats();
+	void stop();
+};
+
+
+void mockSession::start() {
+	if (pool->useTLS()) {
+		stream.async_handshake(boost::asio::ssl::stream_base::server,
+			boost::bind(&mockSession::handleHandshake, shared_from_this(), boost::asio::placeholders::error));
+	} else {
+		read();
+	}
+}
+
+
+void mockSession::handleHandshake(const boost::system::error_code& err) {
+	if (err) {
+		cout << "Session " << id << ": TLS handshake failed: " << err.message() << endl;
+		close();
+		return;
+	}
+	read();
+}
+
+
+void mockSession::read() {
+	if (pool->useTLS()) {
+		boost::asio::async_read_until(stream, responseBuffer, "\n",
+			boost::bind(&mockSession::handleRead, shared_from_this(), boost::asio::placeholders::error));
+	} else {
+		boost::asio::async_read_until(stream.next_layer(), responseBuffer, "\n",
+			boost::bind(&mockSession::handleRead, shared_from_this(), boost::asio::placeholders::error));
+	}
+}
+
+
+void mockSession::handleRead(const boost::system::error_code& err) {
+	if (closed) return;
+	if (err) {
+		close();
+		return;
+	}
+
+	std::istream is(&responseBuffer);
+	string line;
+	getline(is, line);
+	pool->handleLine(shared_from_this(), line);
+
+	if (!closed) read();
+}
+
+
+void mockSession::send(string data) {
+	if (closed) return;
+	writeRequests.push_back(data);
+	activateWrite();
+}
+
+
+void mockSession::activateWrite() {
+	if (!activeWrite && writeRequests.size() > 0) {
+		activeWrite = true;
+
+		std::ostream os(&requestBuffer);
+		os << writeRequests.front() << "\n";
+		if (pool->debug()) cout << "Session " << id << " write: " << writeRequests.front() << endl;
+		writeRequests.pop_front();
+
+		if (pool->useTLS()) {
+			boost::asio::async_write(stream, requestBuffer,
+				boost::bind(&mockSession::handleWrite, shared_from_this(), boost::asio::placeholders::error));
+		} else {
+			boost::asio::async_write(stream.next_layer(), requestBuffer,
+				boost::bind(&mockSession::handleWrite, shared_from_this(), boost::asio::placeholders::error));
+		}
+	}
+}
+
+
+void mockSession::handleWrite(const boost::system::error_code& err) {
+	activeWrite = false;
+	if (err) {
+		close();
+		return;
+	}
+	activateWrite();
+}
+
+
+void mockSession::close() {
+	if (closed) return;
+	closed = true;
+
+	boost::system::error_code ec;
+	stream.lowest_layer().close(ec);
+	pool->removeSession(shared_from_this());
+}
+
+
+// A self signed certificate made at startup, so the mock needs no files
+void mockPool::createCertificate() {
+	EVP_PKEY* pkey = NULL;
+	EVP_PKEY_CTX* kctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL);
+	EVP_PKEY_keygen_init(kctx);
+	EVP_PKEY_CTX_set_ec_paramgen_curve_nid(kctx, NID_X9_62_prime256v1);
+	EVP_PKEY_keygen(kctx, &pkey);
+	EVP_PKEY_CTX_free(kctx);
+
+	X509* cert = X509_new();
+	X509_set_version(cert, 2);
+	ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+	X509_gmtime_adj(X509_get_notBefore(cert), 0);
+	X509_gmtime_adj(X509_get_notAfter(cert), 365 * 24 * 3600);
+	X509_set_pubkey(cert, pkey);
+
+	X509_NAME* name = X509_get_subject_name(cert);
+	X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const unsigned char*) "localhost", -1, -1, 0);
+	X509_set_issuer_name(cert, name);
+	X509_sign(cert, pkey, EVP_sha256());
+
+	SSL_CTX_use_certificate(context.native_handle(), cert);
+	SSL_CTX_use_PrivateKey(context.native_handle(), pkey);
+
+	X509_free(cert);
+	EVP_PKEY_free(pkey);
+}
+
+
+// Script lines: <delay ms> <command> [value], commands are job, diff <packed difficulty>,
+// cancel and disconnect. The script repeats at its end, # starts a comment.
+void mockPool::loadScript() {
+	ifstream file(config.scriptFile);
+	if (!file) {
+		cout << "Can not open script " << config.scriptFile << endl;
+		exit(1);
+	}
+
+	string line;
+	while (getline(file, line)) {
+		if (line.find('#') != string::npos) line = line.substr(0, line.find('#'));
+
+		istringstream ls(line);
+		scriptStep step;
+		step.value = 0;
+		if (ls >> step.delayMs >> step.command) {
+			ls >> step.value;
+			script.push_back(step);
+		}
+	}
+
+	if (script.size() == 0) {
+		cout << "Script " << config.scriptFile << " has no steps" << endl;
+		exit(1);
+	}
+}
+
+
+void mockPool::accept() {
+	sessionPtr session = std::make_shared<mockSession>(io_service, context, this, nextSession++);
+	acceptor.async_accept(session->stream.lowest_layer(),
+		boost::bind(&mockPool::handleAccept, this, session, boost::asio::placeholders::error));
+}
+
+
+void mockPool::handleAccept(sessionPtr session, const boost::system::error_code& err) {
+	if (!err) {
+		boost::system::error_code ec;
+		session->stream.lowest_layer().set_option(tcp::no_delay(true), ec);
+		cout << "Session " << session->id << ": connected from " << session->stream.lowest_layer().remote_endpoint(ec) << endl;
+		sessions.push_back(session);
+		session->start();
+	}
+	accept();
+}
+
+
+void mockPool::removeSession(sessionPtr session) {
+	cout << "Session " << session->id << ": closed" << endl;
+	sessions.remove(session);
+}
+
+
+string mockPool::jobMessage(const mockJob& job) {
+	stringstream json;
+	json << "{\"method\":\"job\", \"id\":\"" << job.id << "\", \"input\":\"" << job.input << "\", \"difficulty\":"
+	     << job.difficulty.m_Packed << ", \"height\":" << job.height << ", \"jsonrpc\":\"2.0\"}";
+	return json.str();
+}
+
+
+void mockPool::newJob() {
+	mockJob job;
+	job.id = to_string(nextJobId++);
+	job.height = height++;
+	job.difficulty = difficulty;
+	job.difficulty.GetTarget(job.target);
+
+	stringstream input;
+	for (uint32_t i=0; i<4; i++) input << std::hex << std::setfill('0') << std::setw(16) << rng();
+	job.input = input.str();
+
+	addJob(job);
+}
+
+
+void mockPool::addJob(mockJob& job) {
+	job.sent = std::chrono::steady_clock::now();
+	if (jobs.size() > 0) jobs.back().replaced = job.sent;
+	jobs.push_back(job);
+	while (jobs.size() > 16) jobs.pop_front();
+
+	string msg = jobMessage(job);
+	for (auto &session : sessions) {
+		if (session->loggedIn) session->send(msg);
+	}
+
+	cout << "Job " << job.id << " (height " << job.height << ", difficulty " << job.difficulty.m_Packed << ") to " << sessions.size() << " miners" << endl;
+}
+
+
+void mockPool::runCommand(const string& command, uint32_t value) {
+	if (command == "job") {
+		newJob();
+	} else if (command == "diff") {
+		difficulty = hds::Difficulty(value);
+		newJob();
+	} else if (command == "cancel") {
+		if (jobs.size() == 0) return;
+		jobs.back().canceled = true;
+		jobs.back().replaced = std::chrono::steady_clock::now();
+
+		stringstream json;
+		json << "{\"method\":\"cancel\", \"id\":\"" << jobs.back().id << "\", \"jsonrpc\":\"2.0\"}";
+		for (auto &session : sessions) session->send(json.str());
+		cout << "Job " << jobs.back().id << " canceled" << endl;
+	} else if (command == "disconnect") {
+		cout << "Disconnecting " << sessions.size() << " miners" << endl;
+		std::list<sessionPtr> all = sessions;
+		for (auto &session : all) session->close();
+	} else {
+		cout << "Unknown script command " << command << endl;
+	}
+}
+
+
+void mockPool::scheduleNext() {
+	uint32_t delay = config.intervalMs;
+	if (script.size() > 0) delay = script[scriptPos].delayMs;
+
+	jobTimer.expires_after(std::chrono::milliseconds(delay));
+	jobTimer.async_wait(boost::bind(&mockPool::handleJobTimer, this, boost::asio::placeholders::error));
+}
+
+
+void mockPool::handleJobTimer(const boost::system::error_code& err) {
+	if (err) return;
+
+	if (script.size() > 0) {
+		runCommand(script[scriptPos].command, script[scriptPos].value);
+		scriptPos = (scriptPos + 1) % script.size();
+	} else {
+		newJob();
+	}
+
+	scheduleNext();
+}
+
+
+// Keeps the pool lines of one pool from the capture, the replay starts with its first login reply
+void mockPool::loadReplay() {
+	stratumCaptureReader reader;
+	if (!reader.open(config.replayFile)) {
+		cout << "Can not open capture " << config.replayFile << endl;
+		exit(1);
+	}
+
+	captureRecord rec;
+	uint64_t results = 0;
+	while (reader.next(rec)) {
+		if (rec.outbound || (rec.pool != config.replayPool)) continue;
+
+		pt::iptree tree;
+		try {
+			istringstream jsonStream(rec.line);
+			pt::read_json(jsonStream, tree);
+		} catch (const pt::ptree_error &e) {
+			continue;
+		}
+
+		bool isLogin = (tree.get<string>("id", "") == "login");
+		if ((tree.get<string>("method", "") == "result") && !isLogin) {
+			results++;
+			continue;
+		}
+		if ((replay.size() == 0) && !isLogin) continue;
+
+		replay.push_back(rec);
+	}
+
+	if (replay.size() == 0) {
+		cout << "Capture " << config.replayFile << " has no login of pool " << config.replayPool << endl;
+		exit(1);
+	}
+
+	double lengthSec = (double) (replay.back().timeUs - replay.front().timeUs) / 1e6;
+	cout << "Replaying " << replay.size() << " lines over " << fixed << setprecision(1) << lengthSec << " seconds at speed " << config.speed 
+	     << ", " << results << " recorded share results are answered live" << endl;
+
+	loginReply = replay.front().line;
+	replayPos = 1;
+}
+
+
+void mockPool::startReplay() {
+	replayStarted = true;
+	replayStart = std::chrono::steady_clock::now();
+	cout << "Replay started" << endl;
+	handleReplayTimer(boost::system::error_code());
+}
+
+
+void mockPool::handleReplayTimer(const boost::system::error_code& err) {
+	if (err) return;
+
+	auto offset = [this](uint32_t pos) {
+		return std::chrono::microseconds((uint64_t) ((double) (replay[pos].timeUs - replay[0].timeUs) / config.speed));
+	};
+
+	while ((replayPos < replay.size()) && (replayStart + offset(replayPos) <= std::chrono::steady_clock::now())) {
+		replayLine(replay[replayPos].line);
+		replayPos++;
+	}
+
+	if (replayPos < replay.size()) {
+		jobTimer.expires_at(replayStart + offset(replayPos));
+		jobTimer.async_wait(boost::bind(&mockPool::handleReplayTimer, this, boost::asio::placeholders::error));
+		return;
+	}
+
+	// Give the last solutions time to arrive
+	cout << "Replay finished" << endl;
+	stopTimer.expires_after(std::chrono::seconds(5));
+	stopTimer.async_wait([this](const boost::system::error_code& err) { if (!err) stop(); });
+}
+
+
+void mockPool::replayLine(const string& line) {
+	pt::iptree tree;
+	try {
+		istringstream jsonStream(line);
+		pt::read_json(jsonStream, tree);
+	} catch (const pt::ptree_error &e) {
+		return;
+	}
+
+	string method = tree.get<string>("method", "");
+
+	if (method == "result") {
+		loginReply = line;
+		cout << "Reconnect in the capture, disconnecting " << sessions.size() << " miners" << endl;
+		std::list<sessionPtr> all = sessions;
+		for (auto &session : all) session->close();
+		return;
+	}
+
+	if (method == "job") {
+		mockJob job;
+		job.id = tree.get<string>("id", "");
+		job.input = tree.get<string>("input", "");
+		job.height = tree.get<uint64_t>("height", 0);
+		job.difficulty = config.forceDifficulty ? difficulty : hds::Difficulty(tree.get<uint32_t>("difficulty", 0));
+		job.difficulty.GetTarget(job.target);
+		addJob(job);
+		return;
+	}
+
+	if ((method == "cancel") && (jobs.size() > 0) && (jobs.back().id == tree.get<string>("id", ""))) {
+		jobs.back().canceled = true;
+		jobs.back().replaced = std::chrono::steady_clock::now();
+	}
+
+	for (auto &session : sessions) {
+		if (session->loggedIn) session->send(line);
+	}
+}
+
+
+// Returns the stratum result code: 1 accepted, 0 stale, -1 invalid, -2 duplicate
+int32_t mockPool::checkShare(pt::iptree& tree, string& nonce, double& ageMs) {
+	string jobId = tree.get<string>("id", "");
+	nonce = tree.get<string>("nonce", "");
+	string output = tree.get<string>("output", "");
+
+	mockJob* job = NULL;
+	for (auto &j : jobs) {
+		if (j.id == jobId) job = &j;
+	}
+	if ((job == NULL) || (nonce.length() != 16)) return -1;
+
+	ageMs = msSince(job->sent);
+
+	if (!seenShares.insert(std::make_pair(jobId, nonce)).second) return -2;
+
+	// Same check as the miner: the SHA256 of the compressed solution must meet the target
+	vector<uint8_t> compressed = parseHex(output);
+	hds::uintBig_t<32> hv;
+	Sha256_Onestep(compressed.data(), compressed.size(), hv.m_pData);
+	if (!job->target.IsReached(hv)) return -1;
+
+	bool current = (job == &jobs.back()) && !job->canceled;
+	if (current) return 1;
+
+	if (!job->canceled && (std::chrono::steady_clock::now() - job->replaced) <= std::chrono::milliseconds(config.staleGraceMs)) return 1;
+	return 0;
+}
+
+
+void mockPool::handleLine(sessionPtr session, const string& line) {
+	if (config.debug) cout << "Session " << session->id << " read: " << line << endl;
+
+	pt::iptree tree;
+	try {
+		istringstream jsonStream(line);
+		pt::read_json(jsonStream, tree);
+	} catch (const pt::ptree_error &e) {
+		cout << "Session " << session->id << ": json parse error " << e.what() << endl;
+		return;
+	}
+
+	string method = tree.get<string>("method", "");
+
+	if (method == "login") {
+		if (loginReply.size() > 0) {
+			session->send(loginReply);
+		} else {
+			stringstream json;
+			json << "{\"method\":\"result\", \"id\":\"login\", \"code\":0, \"forkheight\":0, \"forkheight2\":" << config.forkHeight2;
+			if (config.noncePrefix.size() > 0) json << ", \"nonceprefix\":\"" << config.noncePrefix << "\"";
+			json << ", \"jsonrpc\":\"2.0\"}";
+			session->send(json.str());
+		}
+		session->loggedIn = true;
+
+		if ((replay.size() > 0) && !replayStarted) startReplay();
+
+		if ((jobs.size() > 0) && !jobs.back().canceled) session->send(jobMessage(jobs.back()));
+		return;
+	}
+
+	if (method == "solution") {
+		string nonce;
+		double ageMs = 0;
+		int32_t code = checkShare(tree, nonce, ageMs);
+
+		stringstream json;
+		json << "{\"method\":\"result\", \"id\":\"" << tree.get<string>("id", "") << "\", \"code\":" << code << ", \"jsonrpc\":\"2.0\"}";
+		session->send(json.str());
+
+		const char* names[] = {"duplicate", "invalid", "stale", "accepted"};
+		switch (code) {
+			case 1: accepted++; shareAgeMs += ageMs; break;
+			case 0: stale++; break;
+			case -1: invalid++; break;
+			default: duplicate++;
+		}
+
+		if (record) {
+			record << fixed << setprecision(3) << msSince(started) << "," << session->id << "," << tree.get<string>("id", "") << ","
+			       << nonce << "," << names[code + 2] << "," << ageMs << endl;
+		}
+	}
+}
+
+
+void mockPool::printStats() {
+	uint64_t total = accepted + stale + invalid + duplicate;
+	double stalePct = (total > 0) ? 100.0 * (double) stale / (double) total : 0.0;
+
+	cout << "Shares: " << total << " (accepted " << accepted << ", stale " << stale << ", invalid " << invalid << ", duplicate " << duplicate
+	     << ") stale rate: " << fixed << setprecision(2) << stalePct << " %";
+	if (accepted > 0) cout << ", average job age of accepted shares: " << setprecision(1) << shareAgeMs / (double) accepted << " ms";
+	cout << endl;
+}
+
+
+void mockPool::handleStatsTimer(const boost::system::error_code& err) {
+	if (err) return;
+	printStats();
+
+	statsTimer.expires_after(std::chrono::seconds(10));
+	statsTimer.async_wait(boost::bind(&mockPool::handleStatsTimer, this, boost::asio::placeholders::error));
+}
+
+
+void mockPool::stop() {
+	cout << "Mock pool stopped after " << setprecision(1) << msSince(started) / 1000.0 << " seconds" << endl;
+	printStats();
+	io_service.stop();
+}
+
+
+void mockPool::run() {
+	cout << "Mock pool listening on port " << config.port << (config.useTLS ? " (TLS)" : " (plain TCP)") << endl;
+	started = std::chrono::steady_clock::now();
+
+	accept();
+	if (replay.size() == 0) {
+		newJob();
+		scheduleNext();
+	}
+	handleStatsTimer(boost::system::error_code());
+
+	if (config.durationSec > 0) {
+		stopTimer.expires_after(std::chrono::seconds(config.durationSec));
+		stopTimer.async_wait([this](const boost::system::error_code& err) { if (!err) stop(); });
+	}
+	signals.async_wait([this](const boost::system::error_code& err, int) { if (!err) stop(); });
+
+	io_service.run();
+}
+
+
+mockPool::mockPool(mockConfig configIn) : context(boost::asio::ssl::context::sslv23_server), acceptor(io_service),
+	jobTimer(io_service), statsTimer(io_service), stopTimer(io_service), signals(io_service, SIGINT, SIGTERM) {
+
+	config = configIn;
+	difficulty = hds::Difficulty(config.difficulty);
+
+	random_device rd;
+	rng.seed(rd());
+
+	if (config.useTLS) createCertificate();
+	if (config.scriptFile.size() > 0) loadScript();
+	if (config.replayFile.size() > 0) loadReplay();
+
+	if (config.recordFile.size() > 0) {
+		record.open(config.recordFile);
+		record << "time_ms,session,job,nonce,result,job_age_ms" << endl;
+	}
+
+	tcp::endpoint endpoint(tcp::v4(), config.port);
+	acceptor.open(endpoint.protocol());
+	acceptor.set_option(tcp::acceptor::reuse_address(true));
+	acceptor.bind(endpoint);
+	acceptor.listen();
+}
+
+} // End namespace hdsMiner
+
+
+// Text form of a capture: seconds since the start, pool, direction and the line
+int dumpCapture(const string& fileName) {
+	hdsMiner::stratumCaptureReader reader;
+	if (!reader.open(fileName)) {
+		cout << "Can not open capture " << fileName << endl;
+		return 1;
+	}
+
+	time_t start = (time_t) (reader.startTime() / 1000);
+	cout << "Capture started " << std::put_time(std::localtime(&start), "%Y-%m-%d %H:%M:%S") << endl;
+
+	hdsMiner::captureRecord rec;
+	while (reader.next(rec)) {
+		cout << fixed << setprecision(6) << setw(12) << (double) rec.timeUs / 1e6 << " pool " << rec.pool
+		     << (rec.outbound ? " -> " : " <- ") << rec.line << endl;
+	}
+	return 0;
+}
+
+
+int main(int argc, char* argv[]) {
+	hdsMiner::mockConfig config;
+	vector<string> args(argv, argv+argc);
+
+	for (uint32_t i=1; i<args.size(); i++) {
+		bool hasValue = (i+1 < args.size());
+
+		if ((args[i] == "--port") && hasValue) {
+			config.port = stoi(args[++i]);
+		} else if ((args[i] == "--interval") && hasValue) {
+			config.intervalMs = stoi(args[++i]);
+		} else if ((args[i] == "--difficulty") && hasValue) {
+			config.difficulty = stoul(args[++i]);
+			config.forceDifficulty = true;
+		} else if ((args[i] == "--staleGrace") && hasValue) {
+			config.staleGraceMs = stoi(args[++i]);
+		} else if ((args[i] == "--duration") && hasValue) {
+			config.durationSec = stoi(args[++i]);
+		} else if ((args[i] == "--fork") && hasValue) {
+			config.forkHeight2 = stoull(args[++i]);
+		} else if ((args[i] == "--noncePrefix") && hasValue) {
+			config.noncePrefix = args[++i];
+		} else if ((args[i] == "--script") && hasValue) {
+			config.scriptFile = args[++i];
+		} else if ((args[i] == "--record") && hasValue) {
+			config.recordFile = args[++i];
+		} else if ((args[i] == "--replay") && hasValue) {
+			config.replayFile = args[++i];
+		} else if ((args[i] == "--replayPool") && hasValue) {
+			config.replayPool = stoi(args[++i]);
+		} else if ((args[i] == "--speed") && hasValue) {
+			config.speed = max(0.01, stod(args[++i]));
+		} else if ((args[i] == "--dump") && hasValue) {
+			return dumpCapture(args[++i]);
+		} else if (args[i] == "--noTLS") {
+			config.useTLS = false;
+		} else if (args[i] == "--debug") {
+			config.debug = true;
+		} else {
+			cout << "Mock HDS stratum server for offline tests" << endl;
+			cout << "Parameters: " << endl;
+			cout << " --port <port>			Port to listen on (default: 17000)" << endl;
+			cout << " --interval <ms>		Time between jobs without script (default: 10000)" << endl;
+			cout << " --difficulty <packed>		Packed difficulty of the jobs (default: 0)" << endl;
+			cout << " --staleGrace <ms>		Accept solutions for the previous job this long after a new one (default: 0)" << endl;
+			cout << " --script <file>		Job script, lines of <delay ms> job|diff <packed>|cancel|disconnect" << endl;
+			cout << " --replay <file>		Replay the jobs of a capture made with the miner parameter --capture" << endl;
+			cout << " --replayPool <index>		Pool of the capture to replay (default: 0)" << endl;
+			cout << " --speed <factor>		Replay speed, 10 = ten times faster than recorded (default: 1)" << endl;
+			cout << " --dump <file>			Print a capture as text and exit" << endl;
+			cout << " --record <file>		Write every submitted solution to a CSV file" << endl;
+			cout << " --duration <sec>		Stop after this time and print the statistics" << endl;
+			cout << " --fork <height>		HdsHash III fork height sent at login, jobs start at 1000 (default: 0)" << endl;
+			cout << " --noncePrefix <hex>		Nonce prefix sent with the login reply" << endl;
+			cout << " --noTLS			Plain TCP instead of TLS" << endl;
+			cout << " --debug			Print all stratum messages" << endl;
+			return 0;
+		}
+	}
+
+	hdsMiner::mockPool pool(config);
+	pool.run();
+	return 0;
+}
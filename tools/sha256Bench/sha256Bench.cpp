@@ -0,0 +1,166 @@
+// HDS OpenCL Miner
+// Benchmark of the SHA-256 paths
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+// Compares Sha256_Many and the SHA-NI and AVX2 code the CPU supports with Sha256_Blocks_Portable for
+// random messages, sizes and strides, then times the portable code against each of them.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstring>
+
+#include "crypto/sha256.h"
+#include "crypto/sha256_x86.h"
+
+using namespace std;
+
+namespace {
+
+	const uint32_t initState[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+	const size_t maxSize = 200;
+
+	// Pads the message and hashes it with the portable block function only, size is below maxSize
+	void reference(const uint8_t *msg, size_t size, uint8_t *out) {
+		size_t blocks = (size + 8) / 64 + 1;
+		uint8_t padded[(maxSize / 64 + 2) * 64];
+		memcpy(padded, msg, size);
+		memset(padded + size, 0, blocks * 64 - size);
+		padded[size] = 0x80;
+		uint64_t bits = (uint64_t) size << 3;
+		for (uint32_t i=0; i<8; i++) padded[blocks * 64 - 1 - i] = (uint8_t) (bits >> (8 * i));
+
+		uint32_t state[8];
+		memcpy(state, initState, sizeof(state));
+		Sha256_Blocks_Portable(state, padded, blocks);
+		for (uint32_t i=0; i<8; i++) {
+			for (uint32_t j=0; j<4; j++) out[4*i + j] = (uint8_t) (state[i] >> (24 - 8*j));
+		}
+	}
+
+	// Checks count digests at out against the reference, returns the number of wrong ones
+	uint64_t compare(const vector<uint8_t> &msgs, size_t size, size_t stride, size_t count, const uint8_t *out) {
+		uint64_t wrong = 0;
+		uint8_t expected[SHA256_DIGEST_SIZE];
+		for (size_t i=0; i<count; i++) {
+			reference(&msgs[i*stride], size, expected);
+			if (memcmp(expected, out + i*SHA256_DIGEST_SIZE, SHA256_DIGEST_SIZE) != 0) wrong++;
+		}
+		return wrong;
+	}
+
+	template<typename F> double nsPerHash(uint32_t repeats, size_t count, F f) {
+		auto start = chrono::steady_clock::now();
+		for (uint32_t r=0; r<repeats; r++) f();
+		return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (repeats * count);
+	}
+}
+
+
+int main(int argc, char* argv[]) {
+	uint32_t rounds = (argc > 1) ? stoul(argv[1]) : 10000;
+	mt19937_64 rng(12345);
+
+	cout << "Implementation: " << Sha256_Implementation() << endl;
+
+	// Known answer, so the reference itself is checked
+	const uint8_t abc[3] = {'a', 'b', 'c'};
+	const uint8_t abcDigest[SHA256_DIGEST_SIZE] = {
+		0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad };
+	uint8_t digest[SHA256_DIGEST_SIZE];
+	reference(abc, 3, digest);
+	if (memcmp(digest, abcDigest, SHA256_DIGEST_SIZE) != 0) {
+		cout << "Portable code fails the known answer test" << endl;
+		return 1;
+	}
+
+#ifdef SHA256_X86
+	bool shaNi = Sha256_HasShaNi();
+	bool avx2 = Sha256_HasAvx2();
+	cout << "SHA-NI: " << (shaNi ? "yes" : "no") << ", AVX2: " << (avx2 ? "yes" : "no") << endl;
+#endif
+
+	// Equivalence
+	uint64_t checks = 0;
+	uint64_t mismatches = 0;
+	for (uint32_t r=0; r<rounds; r++) {
+		size_t count = rng() % 21;
+		size_t size = rng() % maxSize;
+		size_t stride = size + (rng() % 3) * (rng() % 23);
+
+		vector<uint8_t> msgs(stride * max<size_t>(count, 8) + size);
+		for (auto &b : msgs) b = (uint8_t) rng();
+		vector<uint8_t> out(SHA256_DIGEST_SIZE * max<size_t>(count, 8));
+
+		Sha256_Many(msgs.data(), size, stride, count, out.data());
+		checks += count;
+		mismatches += compare(msgs, size, stride, count, out.data());
+
+#ifdef SHA256_X86
+		// The kernels directly, so a CPU with SHA-NI tests the AVX2 one as well
+		if (shaNi) {
+			size_t blocks = 1 + size / 64;
+			vector<uint8_t> data(blocks * 64);
+			for (auto &b : data) b = (uint8_t) rng();
+
+			uint32_t expected[8], state[8];
+			memcpy(expected, initState, sizeof(expected));
+			memcpy(state, initState, sizeof(state));
+			Sha256_Blocks_Portable(expected, data.data(), blocks);
+			Sha256_Blocks_ShaNi(state, data.data(), blocks);
+			checks++;
+			if (memcmp(expected, state, sizeof(state)) != 0) mismatches++;
+		}
+		if (avx2) {
+			Sha256_Many8_Avx2(msgs.data(), size, stride, out.data());
+			checks += 8;
+			mismatches += compare(msgs, size, stride, 8, out.data());
+		}
+#endif
+
+		if (mismatches > 0) {
+			cout << "Mismatch for " << count << " messages, size " << size << ", stride " << stride << endl;
+			return 1;
+		}
+	}
+	cout << checks << " hashes checked, all agree with the portable code" << endl;
+
+	// Speed, on 44 byte messages like the Equihash inputs
+	const size_t msgLen = 44;
+	const size_t count = 4096;
+	vector<uint8_t> msgs(count * msgLen);
+	for (auto &b : msgs) b = (uint8_t) rng();
+	vector<uint8_t> out(count * SHA256_DIGEST_SIZE);
+
+	const uint32_t repeats = 200;
+	cout << fixed << setprecision(1);
+	cout << "Portable:    " << nsPerHash(repeats, count, [&]() {
+		for (size_t i=0; i<count; i++) reference(&msgs[i*msgLen], msgLen, &out[i*SHA256_DIGEST_SIZE]);
+	}) << " ns per hash" << endl;
+	cout << "Sha256_Many: " << nsPerHash(repeats, count, [&]() {
+		Sha256_Many(msgs.data(), msgLen, msgLen, count, out.data());
+	}) << " ns per hash" << endl;
+
+#ifdef SHA256_X86
+	if (shaNi) {
+		// The compression alone, per 64 byte block
+		uint32_t state[8];
+		memcpy(state, initState, sizeof(state));
+		cout << "SHA-NI:      " << nsPerHash(repeats, count, [&]() {
+			Sha256_Blocks_ShaNi(state, msgs.data(), count * msgLen / 64);
+		}) * count / (count * msgLen / 64) << " ns per block" << endl;
+	}
+	if (avx2) {
+		cout << "AVX2:        " << nsPerHash(repeats, count, [&]() {
+			for (size_t i=0; i+8<=count; i+=8) Sha256_Many8_Avx2(&msgs[i*msgLen], msgLen, msgLen, &out[i*SHA256_DIGEST_SIZE]);
+		}) << " ns per hash" << endl;
+	}
+#endif
+	return 0;
+}
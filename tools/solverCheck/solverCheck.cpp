@@ -0,0 +1,283 @@
+// HDS OpenCL Miner
+// Check of the solver specs and of the engine
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+// Compares the argument sources of every solver spec with the kernel sources: the count and the types
+// must match and no argument a kernel reads, directly or through a macro, may be bound to a placeholder.
+// With an OpenCL device (a CPU runtime like pocl is enough) it then runs HdsHash III through the engine
+// after a non-zero job epoch was written, on the host and the device prePow path, and requires solutions
+// and no skipped iteration.
+
+#include <iostream>
+#include <regex>
+#include <set>
+#include <sstream>
+
+#include "solvers/hdsSolvers.h"
+#include "crypto/blake2b.h"
+
+using namespace std;
+using namespace hdsMiner;
+
+namespace {
+
+	struct kernelSource {
+		vector< pair<string, string> > params;	// Type and name
+		string body;				// With the macros it uses expanded
+	};
+
+	string stripComments(const string &src) {
+		return regex_replace(regex_replace(src, regex("/\\*[\\s\\S]*?\\*/"), " "), regex("//[^\\n]*"), " ");
+	}
+
+	// Drops the lines of inactive #ifdef and #ifndef branches, with the -D options of the build defined
+	string preprocess(const string &src, const string &buildOptions) {
+		set<string> defined;
+		regex option("-D(\\w+)");
+		for (auto it = sregex_iterator(buildOptions.begin(), buildOptions.end(), option); it != sregex_iterator(); ++it) {
+			defined.insert((*it)[1]);
+		}
+
+		string out;
+		vector<bool> active = {true};
+		stringstream lines(src);
+		string line;
+		smatch m;
+		while (getline(lines, line)) {
+			if (regex_search(line, m, regex("^\\s*#\\s*(ifdef|ifndef)\\s+(\\w+)"))) {
+				bool isDefined = (defined.count(m[2]) > 0);
+				active.push_back(active.back() && ((m[1] == "ifdef") == isDefined));
+				continue;
+			}
+			if (regex_search(line, regex("^\\s*#\\s*else\\b"))) {
+				bool outer = active[active.size() - 2];
+				active.back() = outer && !active.back();
+				continue;
+			}
+			if (regex_search(line, regex("^\\s*#\\s*endif\\b"))) {
+				if (active.size() > 1) active.pop_back();
+				continue;
+			}
+			if (!active.back()) continue;
+			if (regex_search(line, m, regex("^\\s*#\\s*define\\s+(\\w+)"))) defined.insert(m[1]);
+			out += line + "\n";
+		}
+		return out;
+	}
+
+	// The body of every #define, continuation lines included
+	map<string, string> macros(const string &src) {
+		map<string, string> result;
+		string joined = regex_replace(src, regex("\\\\\\s*\\n"), " ");
+		regex def("#define\\s+(\\w+)([^\\n]*)");
+		for (auto it = sregex_iterator(joined.begin(), joined.end(), def); it != sregex_iterator(); ++it) {
+			result[(*it)[1]] = (*it)[2];
+		}
+		return result;
+	}
+
+	string expand(string body, const map<string, string> &defs) {
+		for (uint32_t depth=0; depth<3; depth++) {
+			for (auto &d : defs) {
+				body = regex_replace(body, regex("\\b" + d.first + "\\b"), " " + d.second + " ");
+			}
+		}
+		return body;
+	}
+
+	bool findKernel(const string &src, const map<string, string> &defs, const string &name, kernelSource &out) {
+		smatch m;
+		if (!regex_search(src, m, regex("__kernel[^;{]*?\\bvoid\\s+" + name + "\\s*\\("))) return false;
+
+		size_t open = m.position(0) + m.length(0);
+		size_t close = src.find(')', open);
+		size_t start = src.find('{', close);
+		if ((close == string::npos) || (start == string::npos)) return false;
+
+		size_t end = start + 1;
+		for (int32_t depth = 1; (end < src.size()) && (depth > 0); end++) {
+			if (src[end] == '{') depth++;
+			if (src[end] == '}') depth--;
+		}
+
+		string params = src.substr(open, close - open);
+		regex param("([^,]*[\\s*])(\\w+)\\s*(,|$)");
+		for (auto it = sregex_iterator(params.begin(), params.end(), param); it != sregex_iterator(); ++it) {
+			out.params.push_back({(*it)[1], (*it)[2]});
+		}
+		out.body = expand(src.substr(start, end - start), defs);
+		return true;
+	}
+
+	// Empty if the argument source fits the parameter, the problem otherwise. Only kernels of a
+	// launch must not read a placeholder.
+	string checkArg(const argSpec &arg, const string &type, const string &name, const string &body, bool launched) {
+		bool pointer = (type.find('*') != string::npos);
+		bool read = launched && regex_search(body, regex("\\b" + name + "\\b"));
+
+		switch (arg.source) {
+			case argBuffer:
+			case argEpochBuffer: return pointer ? "" : "buffer bound to a scalar";
+			case argWork: return regex_search(type, regex("\\bulong4\\b")) ? "" : "work needs ulong4";
+			case argNonce:
+			case argNonceStep: return regex_search(type, regex("\\bulong\\b")) ? "" : "needs ulong";
+			case argUnusedUlong4:
+				if (!regex_search(type, regex("\\bulong4\\b"))) return "needs ulong4";
+				return read ? "read by the kernel but bound to a placeholder" : "";
+			case argUnusedUint:
+				if (pointer || !regex_search(type, regex("\\buint\\b"))) return "needs uint";
+				return read ? "read by the kernel but bound to a placeholder" : "";
+			default: return (!pointer && regex_search(type, regex("\\buint\\b"))) ? "" : "needs uint";
+		}
+	}
+
+	uint32_t checkSpec(const string &specName, const solverSpec &spec) {
+		string src = preprocess(stripComments(string((const char*) spec.source, spec.sourceLength)), spec.buildOptions);
+		map<string, string> defs = macros(src);
+		uint32_t problems = 0;
+
+		set<uint32_t> launched;
+		for (auto &launch : spec.launches) {
+			for (auto &step : launch.steps) launched.insert(step.kernel);
+		}
+
+		for (uint32_t kInd=0; kInd<spec.kernels.size(); kInd++) {
+			const kernelSpec &k = spec.kernels[kInd];
+			kernelSource ks;
+			if (!findKernel(src, defs, k.name, ks)) {
+				cout << specName << ": kernel " << k.name << " not found in the source" << endl;
+				problems++;
+				continue;
+			}
+			if (ks.params.size() != k.args.size()) {
+				cout << specName << ": " << k.name << " has " << ks.params.size() << " parameters, the spec binds " << k.args.size() << endl;
+				problems++;
+				continue;
+			}
+			for (uint32_t a=0; a<k.args.size(); a++) {
+				string problem = checkArg(k.args[a], ks.params[a].first, ks.params[a].second, ks.body, launched.count(kInd) > 0);
+				if (problem.empty()) continue;
+				cout << specName << ": " << k.name << " argument " << a << " (" << ks.params[a].second << "): " << problem << endl;
+				problems++;
+			}
+		}
+		return problems;
+	}
+
+	// Runs the launches of one path and counts solutions and skipped iterations
+	cl_int runHdsIII(hdsSolver &solver, cl::CommandQueue &queue, bool devicePrePow, uint32_t launches, uint32_t batch,
+	                 uint64_t &solutions, uint64_t &skipped) {
+		// A fixed header, the nonces count up from 0
+		const uint64_t header[4] = {0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x8796a5b4c3d2e1f0ULL};
+		const uint32_t epoch = 5;
+
+		for (uint32_t l=0; l<launches; l++) {
+			clCallbackData data;
+			data.gpuIndex = 0;
+			data.currentSolver = HdsIII;
+			data.wd.solver = HdsIII;
+			data.wd.epoch = epoch;
+			data.wd.nonce = l * batch;
+			data.wd.nonceStep = 1;
+			data.wd.extraNonce = 0;
+			data.wd.devicePrePow = devicePrePow;
+			data.wd.iterations = batch;
+			memcpy(data.wd.work, header, 32);
+
+			if (!devicePrePow) {
+				uint8_t msg[44];
+				memcpy(&msg[0], header, 32);
+				memcpy(&msg[32], &data.wd.nonce, 8);
+				memcpy(&msg[40], &data.wd.extraNonce, 4);
+				blake2bEquihashBatch(msg, sizeof(msg), 1, 32, 448, 5, (uint8_t*) data.wd.work);
+			}
+
+			cl::Event done;
+			cl_int err = solver.queueKernels(&queue, 0, &done, &data);
+			if (err == CL_SUCCESS) err = done.wait();
+			if (err != CL_SUCCESS) return err;
+
+			uint32_t * results = solver.getResults(0);
+			for (uint32_t it=0; it<data.wd.iterations; it++) {
+				uint32_t * slot = &results[it * resultSlotSize];
+				if (slot[1] != 0) {
+					skipped++;
+				} else {
+					solutions += min<uint32_t>(slot[0], 10);
+				}
+			}
+			solver.unmapResult(&queue, 0);
+		}
+		return queue.finish();
+	}
+}
+
+
+int main(int argc, char* argv[]) {
+	uint32_t launches = (argc > 1) ? stoul(argv[1]) : 8;
+
+	// Bindings, no device needed
+	uint32_t problems = checkSpec("HdsHash I", hdsHashISpec()) + checkSpec("HdsHash II", hdsHashIISpec()) + checkSpec("HdsHash III", hdsHashIIISpec());
+	if (problems > 0) {
+		cout << problems << " binding problems" << endl;
+		return 1;
+	}
+	cout << "Bindings of all specs agree with the kernel sources" << endl;
+
+	// The engine on the first OpenCL device
+	vector<cl::Platform> platforms;
+	vector<cl::Device> devices;
+	cl::Platform::get(&platforms);
+	for (auto &p : platforms) {
+		vector<cl::Device> found;
+		if (p.getDevices(CL_DEVICE_TYPE_ALL, &found) == CL_SUCCESS && !found.empty()) {
+			devices.push_back(found[0]);
+			break;
+		}
+	}
+	if (devices.empty()) {
+		cout << "No OpenCL device, the engine run is skipped" << endl;
+		return 0;
+	}
+	cout << "Device: " << devices[0].getInfo<CL_DEVICE_NAME>() << endl;
+
+	const uint32_t batch = 4;
+	cl_int err = CL_SUCCESS;
+	vector<cl::Context> contexts = {cl::Context(devices[0], NULL, NULL, NULL, &err)};
+	cl::CommandQueue queue(contexts[0], devices[0], 0, &err);
+	cl_uint epoch = 5;
+	vector<cl::Buffer> epochBuffers = {cl::Buffer(contexts[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(cl_uint), &epoch, &err)};
+	if (err != CL_SUCCESS) {
+		cout << "OpenCL setup failed (error " << err << ")" << endl;
+		return 1;
+	}
+
+	hdsSolver solver(hdsHashIIISpec());
+	solver.setBatchSize(batch);
+	solver.setEpochBuffers(epochBuffers);
+	solver.setup(devices, contexts);
+	if (!solver.hasKernels(0)) {
+		cout << "HdsHash III kernels failed to build" << endl;
+		return 1;
+	}
+	err = solver.createBuffers(contexts[0], 0);
+	if (err != CL_SUCCESS) {
+		cout << "HdsHash III buffers failed (error " << err << ")" << endl;
+		return 1;
+	}
+
+	bool failed = false;
+	for (bool devicePrePow : {false, true}) {
+		uint64_t solutions = 0, skipped = 0;
+		err = runHdsIII(solver, queue, devicePrePow, launches, devicePrePow ? batch : 1, solutions, skipped);
+		cout << (devicePrePow ? "Device prePow, batch " + to_string(batch) : string("Host prePow")) << ": " << solutions << " solutions, "
+		     << skipped << " skipped iterations";
+		if (err != CL_SUCCESS) cout << ", OpenCL error " << err;
+		cout << endl;
+		failed = failed || (err != CL_SUCCESS) || (solutions == 0) || (skipped > 0);
+	}
+
+	solver.stop(0);
+	return failed ? 1 : 0;
+}
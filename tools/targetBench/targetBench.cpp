@@ -0,0 +1,118 @@
+// HDS OpenCL Miner
+// Benchmark of the share target check
+// Copyright 2020 The Hds Team
+// Copyright 2020 Wilke Trei
+
+// Compares Difficulty::IsTargetReached, the 512 bit product the node uses, with the precomputed
+// 64 bit word target of the miner. Both must agree for every hash: random difficulties are checked
+// with hashes right around their target and with random ones, then both paths are timed.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <random>
+
+#include "core/difficulty.h"
+
+using namespace std;
+
+namespace {
+
+	typedef hds::uintBig_t<32> hashValue;
+
+	// Random packed difficulty of any order, now and then the infinite and an invalid one
+	uint32_t randomDifficulty(mt19937_64 &rng) {
+		uint32_t pick = rng() % 64;
+		if (pick == 0) return hds::Difficulty::s_Inf;
+		if (pick == 1) return hds::Difficulty::s_Inf + 1 + (rng() % 1000);
+		uint32_t order = rng() % (hds::Difficulty::s_MaxOrder + 1);
+		uint32_t mantissa = rng() & ((1U << hds::Difficulty::s_MantissaBits) - 1);
+		return (order << hds::Difficulty::s_MantissaBits) | mantissa;
+	}
+
+	void storeTarget(const hds::Difficulty::Target &t, int64_t delta, hashValue &hv) {
+		uint64_t w[4] = {t.m_pWord[0], t.m_pWord[1], t.m_pWord[2], t.m_pWord[3]};
+
+		// Add the delta with carry or borrow through the words, wrapping at the ends is fine for the test
+		uint64_t add = (uint64_t) delta;
+		uint64_t carry = 0;
+		uint64_t ext = (delta < 0) ? ~0ULL : 0;
+		for (int32_t i=3; i>=0; i--) {
+			uint64_t a = (i == 3) ? add : ext;
+			uint64_t sum = w[i] + a + carry;
+			carry = ((sum < w[i]) || ((carry == 1) && (sum == w[i]))) ? 1 : 0;
+			w[i] = sum;
+		}
+
+		for (uint32_t i=0; i<4; i++) {
+			for (uint32_t b=0; b<8; b++) hv.m_pData[i*8 + b] = (uint8_t) (w[i] >> (56 - 8*b));
+		}
+	}
+
+	void randomHash(mt19937_64 &rng, hashValue &hv) {
+		// Leading zero bytes make the hashes relevant for higher difficulties too
+		uint32_t zeros = rng() % 33;
+		for (uint32_t i=0; i<32; i++) hv.m_pData[i] = (i < zeros) ? 0 : (uint8_t) rng();
+	}
+}
+
+
+int main(int argc, char* argv[]) {
+	uint32_t rounds = (argc > 1) ? stoul(argv[1]) : 100000;
+	mt19937_64 rng(12345);
+
+	// Equivalence
+	uint64_t checks = 0;
+	uint64_t mismatches = 0;
+	for (uint32_t r=0; r<rounds; r++) {
+		hds::Difficulty diff(randomDifficulty(rng));
+		hds::Difficulty::Target target;
+		diff.GetTarget(target);
+
+		hashValue hv;
+		for (int32_t delta=-2; delta<=2; delta++) {
+			storeTarget(target, delta, hv);
+			checks++;
+			if (diff.IsTargetReached(hv) != target.IsReached(hv)) mismatches++;
+		}
+		for (uint32_t i=0; i<4; i++) {
+			randomHash(rng, hv);
+			checks++;
+			if (diff.IsTargetReached(hv) != target.IsReached(hv)) mismatches++;
+		}
+
+		if (mismatches > 0) {
+			cout << "Mismatch for difficulty " << diff << endl;
+			return 1;
+		}
+	}
+	cout << checks << " hashes checked, both paths agree" << endl;
+
+	// Speed, on a pool of random hashes against a typical pool difficulty
+	vector<hashValue> hashes(4096);
+	for (auto &hv : hashes) randomHash(rng, hv);
+
+	hds::Difficulty diff(0x03000000 | (rng() & 0xffffff));
+	hds::Difficulty::Target target;
+
+	const uint32_t iterations = 10000000;
+	uint64_t reached = 0;
+
+	auto start = chrono::steady_clock::now();
+	for (uint32_t i=0; i<iterations; i++) reached += diff.IsTargetReached(hashes[i & 4095]);
+	double productNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / iterations;
+
+	start = chrono::steady_clock::now();
+	for (uint32_t i=0; i<iterations; i++) diff.GetTarget(target);
+	double prepareNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / iterations;
+
+	start = chrono::steady_clock::now();
+	for (uint32_t i=0; i<iterations; i++) reached -= target.IsReached(hashes[i & 4095]);
+	double targetNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / iterations;
+
+	cout << fixed << setprecision(1);
+	cout << "IsTargetReached: " << productNs << " ns per hash" << endl;
+	cout << "Target:          " << targetNs << " ns per hash, " << prepareNs << " ns once per job" << endl;
+	return (reached == 0) ? 0 : 1;
+}